@@ -1,58 +1,232 @@
 // Buffer cache.
 //
-// The buffer cache is a linked list of buf structures holding
+// The buffer cache is a hash table of buf structures holding
 // cached copies of disk block contents.  Caching disk blocks
 // in memory reduces the number of disk reads and also provides
 // a synchronization point for disk blocks used by multiple processes.
 //
 // Interface:
 // * To get a buffer for a particular disk block, call bread.
-// * After changing buffer data, call bwrite to write it to disk.
+// * To get a buffer for a block that is about to be entirely
+//     overwritten, call bgetblk; it skips the disk read.
+// * After changing buffer data, call bwrite to write it to disk,
+//     or bdwrite to have it written later.
+// * To have several transfers in flight at once, start each
+//     with bread_async or bwrite_async, and call bwait on
+//     each buffer before using its data or releasing it.
 // * When done with the buffer, call brelse.
 // * Do not use the buffer after calling brelse.
 // * Only one process at a time can use a buffer,
 //     so do not keep them longer than necessary.
+// * bflush writes delayed-write buffers back to disk.
+// * If the disk gives up on a transfer, bread, bwrite and
+//     bwait report it and leave B_ERROR set in b->flags.
 //
-// The implementation uses two state flags internally:
+// Buffers are hashed on (dev, blockno) into NBUCKET chains,
+// each with its own lock, so a cache hit takes one bucket lock
+// and processes using different blocks rarely contend.  A
+// bucket lock protects its chain and the refcnt of the buffers
+// on it.  Moving a buffer to another block happens only under
+// bcache.lock, which picks victims with a clock sweep: brelse
+// sets b->used, and the sweep clears it, recycling the first
+// unused buffer whose bit is already clear.
+//
+// The cache starts with the NBUF buffers in bpool and grows
+// a page of buffers at a time, from kalloc, whenever a miss
+// finds no free buffer, until it holds 1/BCACHEFRAC of
+// physical memory.  Only then are cached blocks recycled.
+// When kalloc runs out of pages it calls bshrink, which hands
+// back every grown page whose buffers are idle and clean.
+//
+// The implementation uses three state flags internally:
 // * B_VALID: the buffer data has been read from the disk.
 // * B_DIRTY: the buffer data has been modified
 //     and needs to be written to disk.
+// * B_DELWRI: the buffer data has been modified, but the
+//     write has been deferred.  The flusher process writes
+//     such buffers back every BFLUSHTICKS ticks, in block
+//     order.  bget never writes one back itself, since its
+//     caller may hold other buffers: when it needs a buffer
+//     and no clean one is free, it waits for the flusher.
 
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
 
-struct {
+#define NBUCKET 1021
+
+// Buffers are allocated a page at a time.
+struct bufpage {
+  struct bufpage *next;  // list of all pages, through next
+  int kalloced;          // from kalloc, rather than bpool
+  struct buf buf[(PGSIZE - 2*sizeof(int)) / sizeof(struct buf)];
+};
+#define BPP NELEM(((struct bufpage*)0)->buf)  // buffers per page
+
+struct bucket {
   struct spinlock lock;
-  struct buf buf[NBUF];
+  struct buf *head;  // chain of buffers, through next
+};
 
-  // Linked list of all buffers, through prev/next.
-  // head.next is most recently used.
-  struct buf head;
+// bcache.lock serializes recycling, growing and shrinking,
+// and protects the page list, the free list and the hand.
+struct {
+  struct spinlock lock;
+  struct bufpage *pages;
+  int npages;             // pages allocated with kalloc
+  int ndelwri;            // buffers with B_DELWRI set
+  int nwait;              // bgets waiting for the flusher
+  int maxpages;
+  struct buf *free;       // buffers holding no block, through next
+  struct bufpage *hand;   // clock hand: hand->buf[handi]
+  int handi;
+  struct bucket bucket[NBUCKET];
 } bcache;
 
+static struct bufpage bpool[(NBUF + BPP - 1) / BPP];
+
+static struct bucket*
+bhash(uint dev, uint blockno)
+{
+  return &bcache.bucket[(dev * 31 + blockno) % NBUCKET];
+}
+
+// Unlink b from the chain of bk.  Caller holds bk->lock.
+static void
+bunlink(struct bucket *bk, struct buf *b)
+{
+  struct buf **pp;
+
+  for(pp = &bk->head; *pp != b; pp = &(*pp)->next)
+    if(*pp == 0)
+      panic("bunlink");
+  *pp = b->next;
+  b->hashed = 0;
+}
+
+// Add b to the chain of bk.  Caller holds bk->lock.
+static void
+blink(struct bucket *bk, struct buf *b)
+{
+  b->next = bk->head;
+  bk->head = b;
+  b->hashed = 1;
+}
+
+// Add the buffers of page p to the cache, on the free list.
+// Caller holds bcache.lock.
+static void
+baddpage(struct bufpage *p)
+{
+  struct buf *b;
+
+  for(b = p->buf; b < p->buf+BPP; b++){
+    initsleeplock(&b->lock, "buffer");
+    b->next = bcache.free;
+    bcache.free = b;
+  }
+  p->next = bcache.pages;
+  bcache.pages = p;
+}
+
 void
 binit(void)
 {
-  struct buf *b;
+  struct bufpage *p;
+  struct bucket *bk;
 
+  if(sizeof(struct bufpage) > PGSIZE)
+    panic("binit: bufpage");
   initlock(&bcache.lock, "bcache");
 
 //PAGEBREAK!
-  // Create linked list of buffers
-  bcache.head.prev = &bcache.head;
-  bcache.head.next = &bcache.head;
-  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    initsleeplock(&b->lock, "buffer");
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+  for(bk = bcache.bucket; bk < bcache.bucket+NBUCKET; bk++)
+    initlock(&bk->lock, "bcache.bucket");
+  for(p = bpool; p < bpool+NELEM(bpool); p++)
+    baddpage(p);
+  bcache.hand = bcache.pages;
+  bcache.maxpages = PHYSTOP / PGSIZE / BCACHEFRAC;
+}
+
+// Grow the cache by a page of buffers, if it is allowed
+// to and kalloc has a page to spare.  Returns 0 if not.
+// Caller holds bcache.lock.
+static int
+bgrow(void)
+{
+  struct bufpage *p;
+
+  if(bcache.npages >= bcache.maxpages)
+    return 0;
+  if((p = (struct bufpage*)kalloc()) == 0)
+    return 0;
+  memset(p, 0, PGSIZE);
+  p->kalloced = 1;
+  baddpage(p);
+  bcache.npages++;
+  return 1;
+}
+
+// Look for block on device dev in its bucket.  If found,
+// take a reference and return it.  Caller holds bk->lock.
+static struct buf*
+bfind(struct bucket *bk, uint dev, uint blockno)
+{
+  struct buf *b;
+
+  for(b = bk->head; b != 0; b = b->next){
+    if(b->dev == dev && b->blockno == blockno){
+      b->refcnt++;
+      return b;
+    }
+  }
+  return 0;
+}
+
+// Find a buffer to recycle: one that is unreferenced and
+// has no pending write, and has not been used since the
+// clock hand last passed it.  Unlinks it from its chain and
+// returns it with its bucket lock released, or returns 0 if
+// every buffer is busy or waiting to be written.  Caller
+// holds bcache.lock.
+static struct buf*
+bvictim(void)
+{
+  struct buf *b;
+  struct bucket *bk;
+  int i, n;
+
+  n = 2 * BPP * (NELEM(bpool) + bcache.npages);
+  for(i = 0; i < n; i++){
+    b = &bcache.hand->buf[bcache.handi];
+    if(++bcache.handi == BPP){
+      bcache.handi = 0;
+      if((bcache.hand = bcache.hand->next) == 0)
+        bcache.hand = bcache.pages;
+    }
+    if(!b->hashed)
+      continue;
+    bk = bhash(b->dev, b->blockno);
+    acquire(&bk->lock);
+    if(b->refcnt == 0){
+      // Even if refcnt==0, B_DIRTY indicates a buffer is in use
+      // because log.c has modified it but not yet committed it.
+      if((b->flags & (B_DIRTY|B_DELWRI)) == 0 && !b->used){
+        bunlink(bk, b);
+        release(&bk->lock);
+        return b;
+      }
+      b->used = 0;
+    }
+    release(&bk->lock);
   }
+  return 0;
 }
 
 // Look through buffer cache for block on device dev.
@@ -62,37 +236,158 @@ static struct buf*
 bget(uint dev, uint blockno)
 {
   struct buf *b;
+  struct bucket *bk;
 
-  acquire(&bcache.lock);
+  bk = bhash(dev, blockno);
 
   // Is the block already cached?
-  for(b = bcache.head.next; b != &bcache.head; b = b->next){
-    if(b->dev == dev && b->blockno == blockno){
-      b->refcnt++;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
-      return b;
+  acquire(&bk->lock);
+  b = bfind(bk, dev, blockno);
+  release(&bk->lock);
+  if(b){
+    acquiresleep(&b->lock);
+    return b;
+  }
+
+  // Not cached; use a free buffer, growing the cache if
+  // there is none, or else recycle one.  Look again under
+  // bcache.lock, in case another process was doing the same.
+  acquire(&bcache.lock);
+  for(;;){
+    acquire(&bk->lock);
+    b = bfind(bk, dev, blockno);
+    release(&bk->lock);
+    if(b)
+      break;
+
+    if(bcache.free || bgrow()){
+      b = bcache.free;
+      bcache.free = b->next;
+    } else if((b = bvictim()) == 0){
+      // No clean buffer is free.  Have the flusher write
+      // back the delayed writes, and look again when it
+      // has, since the block may have been read in meanwhile.
+      if(bcache.ndelwri == 0)
+        panic("bget: no buffers");
+      bcache.nwait++;
+      sleep(&bcache.nwait, &bcache.lock);
+      bcache.nwait--;
+      continue;
     }
+    b->dev = dev;
+    b->blockno = blockno;
+    b->flags = 0;
+    b->refcnt = 1;
+    b->used = 0;
+    acquire(&bk->lock);
+    blink(bk, b);
+    release(&bk->lock);
+    break;
+  }
+  release(&bcache.lock);
+  acquiresleep(&b->lock);
+  return b;
+}
+
+// Try to take every buffer of page p out of the cache.
+// Succeeds only if all of them are unreferenced and clean,
+// checked and unlinked while holding all their bucket locks
+// so that no lookup can find one in between.  Caller holds
+// bcache.lock.
+static int
+bdetach(struct bufpage *p)
+{
+  struct bucket *bk[BPP], *t;
+  struct buf *b, **pp;
+  int i, j, n, ok;
+
+  // Collect the distinct buckets in address order, the
+  // order in which they are acquired.
+  n = 0;
+  for(b = p->buf; b < p->buf+BPP; b++){
+    if(!b->hashed)
+      continue;
+    t = bhash(b->dev, b->blockno);
+    for(i = 0; i < n && bk[i] < t; i++)
+      ;
+    if(i < n && bk[i] == t)
+      continue;
+    for(j = n; j > i; j--)
+      bk[j] = bk[j-1];
+    bk[i] = t;
+    n++;
   }
+  for(i = 0; i < n; i++)
+    acquire(&bk[i]->lock);
 
-  // Not cached; recycle an unused buffer.
-  // Even if refcnt==0, B_DIRTY indicates a buffer is in use
-  // because log.c has modified it but not yet committed it.
-  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
-    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
-      b->dev = dev;
-      b->blockno = blockno;
-      b->flags = 0;
-      b->refcnt = 1;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
-      return b;
+  ok = 1;
+  for(b = p->buf; b < p->buf+BPP; b++)
+    if(b->hashed && (b->refcnt != 0 || (b->flags & (B_DIRTY|B_DELWRI))))
+      ok = 0;
+  if(ok){
+    for(b = p->buf; b < p->buf+BPP; b++)
+      if(b->hashed)
+        bunlink(bhash(b->dev, b->blockno), b);
+  }
+  for(i = 0; i < n; i++)
+    release(&bk[i]->lock);
+  if(!ok)
+    return 0;
+
+  // Drop the page's buffers from the free list.
+  for(pp = &bcache.free; *pp; ){
+    if(*pp >= p->buf && *pp < p->buf+BPP)
+      *pp = (*pp)->next;
+    else
+      pp = &(*pp)->next;
+  }
+  return 1;
+}
+
+// Return to kalloc every page of buffers that are all
+// unreferenced and clean.  Called by kalloc when it has no
+// free pages.  Returns the number of pages freed.
+int
+bshrink(void)
+{
+  struct bufpage *p, **pp;
+  int n;
+
+  // kalloc may have been called by bgrow.
+  if(holding(&bcache.lock))
+    return 0;
+
+  acquire(&bcache.lock);
+  n = 0;
+  for(pp = &bcache.pages; (p = *pp) != 0; ){
+    if(!p->kalloced || !bdetach(p)){
+      pp = &p->next;
+      continue;
     }
+    *pp = p->next;
+    if(bcache.hand == p){
+      bcache.hand = bcache.pages;
+      bcache.handi = 0;
+    }
+    bcache.npages--;
+    kfree((char*)p);
+    n++;
   }
-  panic("bget: no buffers");
+  release(&bcache.lock);
+  return n;
+}
+
+// Report a transfer on b that the disk gave up on.  B_ERROR
+// stays set for callers that check.
+static void
+bioerror(struct buf *b)
+{
+  if(b->flags & B_ERROR)
+    cprintf("bio: i/o error, dev %d block %d\n", b->dev, b->blockno);
 }
 
 // Return a locked buf with the contents of the indicated block.
+// If the read fails, b has B_ERROR set and its data is garbage.
 struct buf*
 bread(uint dev, uint blockno)
 {
@@ -101,44 +396,277 @@ bread(uint dev, uint blockno)
   b = bget(dev, blockno);
   if((b->flags & B_VALID) == 0) {
     iderw(b);
+    bioerror(b);
   }
   return b;
 }
 
+// Start reading the indicated block and return a locked buf
+// for it, without waiting for the data.  Call bwait before
+// using b->data.
+struct buf*
+bread_async(uint dev, uint blockno)
+{
+  struct buf *b;
+
+  b = bget(dev, blockno);
+  if((b->flags & B_VALID) == 0)
+    iderw_async(b);
+  return b;
+}
+
+// Start reading the indicated block into the cache, but do
+// not wait for it.  Does nothing if the block is cached or
+// already being read.  Used for read-ahead.
+void
+breada(uint dev, uint blockno)
+{
+  struct buf *b;
+  struct bucket *bk;
+
+  bk = bhash(dev, blockno);
+  acquire(&bk->lock);
+  for(b = bk->head; b != 0; b = b->next)
+    if(b->dev == dev && b->blockno == blockno)
+      break;
+  release(&bk->lock);
+  if(b)
+    return;
+
+  b = bget(dev, blockno);
+  if(b->flags & B_VALID){
+    brelse(b);
+    return;
+  }
+  // The disk driver calls biodone when the read completes,
+  // which releases b on our behalf.
+  b->flags |= B_ASYNC;
+  iderw_async(b);
+}
+
+// Return a locked buf for the indicated block without
+// reading it from disk.  For callers about to overwrite the
+// whole block: the contents are undefined until they have
+// filled b->data and passed it to bwrite or bdwrite.
+struct buf*
+bgetblk(uint dev, uint blockno)
+{
+  return bget(dev, blockno);
+}
+
+// Set (on) or clear B_DELWRI on b, keeping count of the
+// delayed writes for bflushd.  Must be locked.
+void
+bdelwri(struct buf *b, int on)
+{
+  if(((b->flags & B_DELWRI) != 0) == on)
+    return;
+  acquire(&bcache.lock);
+  if(on){
+    b->flags |= B_DELWRI;
+    bcache.ndelwri++;
+  } else {
+    b->flags &= ~B_DELWRI;
+    bcache.ndelwri--;
+  }
+  release(&bcache.lock);
+}
+
 // Write b's contents to disk.  Must be locked.
 void
 bwrite(struct buf *b)
 {
   if(!holdingsleep(&b->lock))
     panic("bwrite");
+  bdelwri(b, 0);
   b->flags |= B_DIRTY;
   iderw(b);
+  bioerror(b);
 }
 
-// Release a locked buffer.
-// Move to the head of the MRU list.
+// Start writing b's contents to disk without waiting.
+// Must be locked, and stay locked until bwait returns.
 void
-brelse(struct buf *b)
+bwrite_async(struct buf *b)
 {
   if(!holdingsleep(&b->lock))
-    panic("brelse");
+    panic("bwrite_async");
+  bdelwri(b, 0);
+  b->flags |= B_DIRTY;
+  iderw_async(b);
+}
+
+// Wait for the transfer that bread_async or bwrite_async
+// started on b.  Must be locked.
+void
+bwait(struct buf *b)
+{
+  if(!holdingsleep(&b->lock))
+    panic("bwait");
+  iderw_wait(b);
+  bioerror(b);
+}
+
+// Mark b's contents as needing to be written to disk,
+// but leave the write to the flusher.  Must be locked.
+// A block the log has pinned is left for the log to write.
+void
+bdwrite(struct buf *b)
+{
+  if(!holdingsleep(&b->lock))
+    panic("bdwrite");
+  b->flags |= B_VALID;
+  if((b->flags & B_DIRTY) == 0)
+    bdelwri(b, 1);
+}
+
+// Write back the delayed-write buffers of device dev, or of
+// all devices if dev is -1, and wait for the writes.  Skips
+// buffers that are in use unless all is set: the flusher must
+// not sleep on a buffer whose holder may be waiting in bget.
+// Buffers are written in batches of up to BFLUSHBATCH, each
+// in block order so the disk head sweeps across once.
+static void
+bflushsome(int dev, int all)
+{
+  struct buf *b, *list[BFLUSHBATCH];
+  struct bufpage *p;
+  struct bucket *bk;
+  int i, j, n;
+
+  do {
+    // Holding bcache.lock keeps buffers from being recycled,
+    // so b->dev and b->blockno stay put while we look.
+    acquire(&bcache.lock);
+    n = 0;
+    for(p = bcache.pages; p && n < BFLUSHBATCH; p = p->next){
+      for(b = p->buf; b < p->buf+BPP && n < BFLUSHBATCH; b++){
+        if(!b->hashed || (b->flags & B_DELWRI) == 0)
+          continue;
+        if(dev >= 0 && b->dev != dev)
+          continue;
+        // Two references: one for the write to drop, one
+        // to wait with.
+        bk = bhash(b->dev, b->blockno);
+        acquire(&bk->lock);
+        if(!all && b->refcnt != 0){
+          release(&bk->lock);
+          continue;
+        }
+        b->refcnt += 2;
+        release(&bk->lock);
+        // Insertion sort by (dev, blockno).
+        for(i = n; i > 0; i--){
+          if(list[i-1]->dev < b->dev ||
+             (list[i-1]->dev == b->dev && list[i-1]->blockno < b->blockno))
+            break;
+          list[i] = list[i-1];
+        }
+        list[i] = b;
+        n++;
+      }
+    }
+    release(&bcache.lock);
+
+    // Start all the writes before waiting for any, so the
+    // disk can merge adjacent blocks.  Each write releases its
+    // buffer when done, so we never sleep on one buffer while
+    // holding another that its owner may be waiting for.
+    for(j = 0; j < n; j++){
+      b = list[j];
+      acquiresleep(&b->lock);
+      if(b->flags & B_DELWRI){
+        bdelwri(b, 0);
+        b->flags |= B_DIRTY|B_ASYNC;
+        iderw_async(b);
+      } else
+        brelse(b);
+    }
+    for(j = 0; j < n; j++){
+      b = list[j];
+      acquiresleep(&b->lock);
+      bioerror(b);
+      brelse(b);
+    }
+
+    // The buffers just written can be recycled now.
+    acquire(&bcache.lock);
+    if(bcache.nwait > 0)
+      wakeup(&bcache.nwait);
+    release(&bcache.lock);
+  } while(n == BFLUSHBATCH);
+}
+
+// Write back every delayed-write buffer of device dev,
+// or of all devices if dev is -1, and wait for the writes.
+void
+bflush(int dev)
+{
+  bflushsome(dev, 1);
+}
+
+// The flusher process.  Writes delayed-write buffers back
+// every BFLUSHTICKS ticks, or sooner if more than half of
+// the cache is waiting to be written or bget is waiting
+// for a clean buffer.
+void
+bflushd(void)
+{
+  uint ticks0;
+  int full;
+
+  for(;;){
+    acquire(&tickslock);
+    ticks0 = ticks;
+    for(;;){
+      sleep(&ticks, &tickslock);
+      if(ticks - ticks0 >= BFLUSHTICKS)
+        break;
+      acquire(&bcache.lock);
+      full = bcache.ndelwri > BPP * (NELEM(bpool) + bcache.npages) / 2 ||
+             bcache.nwait > 0;
+      release(&bcache.lock);
+      if(full)
+        break;
+    }
+    release(&tickslock);
+    bflushsome(-1, 0);
+  }
+}
+
+// Drop a reference to b and unlock it.
+// Mark it recently used for the clock sweep.
+static void
+bput(struct buf *b)
+{
+  struct bucket *bk;
 
   releasesleep(&b->lock);
 
-  acquire(&bcache.lock);
+  bk = bhash(b->dev, b->blockno);
+  acquire(&bk->lock);
   b->refcnt--;
-  if (b->refcnt == 0) {
-    // no one is waiting for it.
-    b->next->prev = b->prev;
-    b->prev->next = b->next;
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
-  }
-  
-  release(&bcache.lock);
+  if (b->refcnt == 0)
+    b->used = 1;
+  release(&bk->lock);
+}
+
+// Release a locked buffer.
+void
+brelse(struct buf *b)
+{
+  if(!holdingsleep(&b->lock))
+    panic("brelse");
+  bput(b);
+}
+
+// Called by the disk driver, possibly from an interrupt,
+// when an asynchronous transfer started with iderw_async
+// completes.  Releases b for the process that started it.
+void
+biodone(struct buf *b)
+{
+  bput(b);
 }
 //PAGEBREAK!
 // Blank page.
-
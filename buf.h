@@ -4,11 +4,17 @@ struct buf {
   uint blockno;
   struct sleeplock lock;
   uint refcnt;
-  struct buf *prev; // LRU cache list
-  struct buf *next;
+  int used;          // referenced since the clock hand passed
+  int hashed;        // on a hash chain, holding dev/blockno
+  struct buf *next;  // hash chain or free list
   struct buf *qnext; // disk queue
+  uint qtime;        // when it joined the disk queue, in ticks
+  uint64 qcyc;       // and in CPU cycles
   uchar data[BSIZE];
 };
 #define B_VALID 0x2  // buffer has been read from disk
 #define B_DIRTY 0x4  // buffer needs to be written to disk
+#define B_DELWRI 0x8 // buffer modified, write to disk deferred
+#define B_ASYNC 0x10 // nobody waits for the transfer; release when done
+#define B_ERROR 0x20 // the last transfer failed
 
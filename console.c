@@ -191,7 +191,7 @@ struct {
 void
 consoleintr(int (*getc)(void))
 {
-  int c, doprocdump = 0;
+  int c, doprocdump = 0, doidedump = 0;
 
   acquire(&cons.lock);
   while((c = getc()) >= 0){
@@ -200,6 +200,9 @@ consoleintr(int (*getc)(void))
       // procdump() locks cons.lock indirectly; invoke later
       doprocdump = 1;
       break;
+    case C('T'):  // Disk statistics.
+      doidedump = 1;
+      break;
     case C('U'):  // Kill line.
       while(input.e != input.w &&
             input.buf[(input.e-1) % INPUT_BUF] != '\n'){
@@ -230,6 +233,11 @@ consoleintr(int (*getc)(void))
   if(doprocdump) {
     procdump();  // now call procdump() wo. cons.lock held
   }
+  if(doidedump){
+    idedump();
+    logdump();
+    dcachedump();
+  }
 }
 
 int
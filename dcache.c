@@ -0,0 +1,216 @@
+// Directory entry cache.
+//
+// The dentry cache remembers what dirlookup found for a name
+// in a directory, so that namex can resolve the elements of
+// a path it has seen recently without reading and scanning
+// the directories along it.  An entry maps (dev, directory
+// inum, name) to the inum the name refers to, or to 0 if the
+// directory has no such name, so that misses are cached too.
+//
+// Interface:
+// * dcache_lookup returns 1 and sets *inum if the cache has
+//     an entry for name in directory dp, and 0 if the name
+//     must be looked up.
+// * dcache_enter records the result of a lookup.
+// * dcache_remove forgets a name; call it whenever a name is
+//     added to or removed from a directory.
+// * dcache_purge forgets all names in a directory; call it
+//     when an inode is allocated, in case it was once a
+//     directory whose entries are still cached.
+//
+// Callers hold dp's lock, which keeps the cache and the
+// directory in step.  dcache.lock protects the hash chains
+// and the LRU list.  Entries are hashed into NDHASH chains;
+// when all NDENTRY entries are in use, the least recently
+// used one is recycled.  Names of DNAMELEN or more bytes are
+// not cached, nor are xv6 names that skipelem truncated to
+// DIRSIZ bytes and so did not NUL-terminate.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
+
+#define NDHASH 67
+#define DNAMELEN 28
+
+struct dentry {
+  uint dev;
+  uint dir;              // inum of the directory
+  uint inum;             // inum of the name, 0 if none
+  char name[DNAMELEN];   // empty if the entry is unused
+  struct dentry *next;   // hash chain
+  struct dentry *lprev;  // LRU list, most recent first
+  struct dentry *lnext;
+};
+
+struct {
+  struct spinlock lock;
+  struct dentry dentry[NDENTRY];
+  struct dentry *hash[NDHASH];
+  struct dentry lru;     // head of the LRU list
+  uint hits;
+  uint misses;
+} dcache;
+
+// Can name be a key for directory dp?
+static int
+dcacheable(struct inode *dp, char *name)
+{
+  int i, n;
+
+  n = dp->dev == ROOTDEV ? DIRSIZ : DNAMELEN;
+  for(i = 0; i < n; i++)
+    if(name[i] == 0)
+      return i > 0;
+  return 0;
+}
+
+static uint
+dhash(uint dev, uint dir, char *name)
+{
+  uint h;
+
+  h = dev * 31 + dir;
+  while(*name)
+    h = h * 31 + (uchar)*name++;
+  return h % NDHASH;
+}
+
+// Move d to the front of the LRU list.  Caller holds dcache.lock.
+static void
+dtouch(struct dentry *d)
+{
+  d->lprev->lnext = d->lnext;
+  d->lnext->lprev = d->lprev;
+  d->lnext = dcache.lru.lnext;
+  d->lprev = &dcache.lru;
+  dcache.lru.lnext->lprev = d;
+  dcache.lru.lnext = d;
+}
+
+// Remove d from its hash chain, and make it the first to be
+// recycled.  Caller holds dcache.lock.
+static void
+dfree(struct dentry *d)
+{
+  struct dentry **pp;
+
+  for(pp = &dcache.hash[dhash(d->dev, d->dir, d->name)]; *pp != d; pp = &(*pp)->next)
+    if(*pp == 0)
+      panic("dfree");
+  *pp = d->next;
+  d->name[0] = 0;
+  d->lprev->lnext = d->lnext;
+  d->lnext->lprev = d->lprev;
+  d->lprev = dcache.lru.lprev;
+  d->lnext = &dcache.lru;
+  dcache.lru.lprev->lnext = d;
+  dcache.lru.lprev = d;
+}
+
+// Find the entry for name in dir.  Caller holds dcache.lock.
+static struct dentry*
+dfind(uint dev, uint dir, char *name)
+{
+  struct dentry *d;
+
+  for(d = dcache.hash[dhash(dev, dir, name)]; d != 0; d = d->next)
+    if(d->dev == dev && d->dir == dir && strncmp(d->name, name, DNAMELEN) == 0)
+      return d;
+  return 0;
+}
+
+void
+dcacheinit(void)
+{
+  struct dentry *d;
+
+  initlock(&dcache.lock, "dcache");
+  dcache.lru.lnext = dcache.lru.lprev = &dcache.lru;
+  for(d = dcache.dentry; d < dcache.dentry+NDENTRY; d++){
+    d->lnext = dcache.lru.lnext;
+    d->lprev = &dcache.lru;
+    dcache.lru.lnext->lprev = d;
+    dcache.lru.lnext = d;
+  }
+}
+
+int
+dcache_lookup(struct inode *dp, char *name, uint *inum)
+{
+  struct dentry *d;
+
+  if(!dcacheable(dp, name))
+    return 0;
+  acquire(&dcache.lock);
+  if((d = dfind(dp->dev, dp->inum, name)) == 0){
+    dcache.misses++;
+    release(&dcache.lock);
+    return 0;
+  }
+  dtouch(d);
+  *inum = d->inum;
+  dcache.hits++;
+  release(&dcache.lock);
+  return 1;
+}
+
+void
+dcache_enter(struct inode *dp, char *name, uint inum)
+{
+  struct dentry *d, **pp;
+
+  if(!dcacheable(dp, name))
+    return;
+  acquire(&dcache.lock);
+  if((d = dfind(dp->dev, dp->inum, name)) == 0){
+    d = dcache.lru.lprev;
+    if(d->name[0] != 0)
+      dfree(d);
+    d->dev = dp->dev;
+    d->dir = dp->inum;
+    safestrcpy(d->name, name, DNAMELEN);
+    pp = &dcache.hash[dhash(d->dev, d->dir, name)];
+    d->next = *pp;
+    *pp = d;
+  }
+  d->inum = inum;
+  dtouch(d);
+  release(&dcache.lock);
+}
+
+void
+dcache_remove(struct inode *dp, char *name)
+{
+  struct dentry *d;
+
+  if(!dcacheable(dp, name))
+    return;
+  acquire(&dcache.lock);
+  if((d = dfind(dp->dev, dp->inum, name)) != 0)
+    dfree(d);
+  release(&dcache.lock);
+}
+
+void
+dcache_purge(struct inode *dp)
+{
+  struct dentry *d;
+
+  acquire(&dcache.lock);
+  for(d = dcache.dentry; d < dcache.dentry+NDENTRY; d++)
+    if(d->name[0] != 0 && d->dev == dp->dev && d->dir == dp->inum)
+      dfree(d);
+  release(&dcache.lock);
+}
+
+// Print cache statistics to the console.  For debugging.
+void
+dcachedump(void)
+{
+  cprintf("dcache: %d hits %d misses\n", dcache.hits, dcache.misses);
+}
@@ -14,8 +14,19 @@ struct ext2_super_block;
 // bio.c
 void            binit(void);
 struct buf*     bread(uint, uint);
+void            breada(uint, uint);
+struct buf*     bread_async(uint, uint);
+void            bwrite_async(struct buf*);
+void            bwait(struct buf*);
+void            biodone(struct buf*);
+struct buf*     bgetblk(uint, uint);
 void            brelse(struct buf*);
 void            bwrite(struct buf*);
+void            bdwrite(struct buf*);
+void            bdelwri(struct buf*, int);
+void            bflush(int);
+void            bflushd(void) __attribute__((noreturn));
+int             bshrink(void);
 
 // console.c
 void            consoleinit(void);
@@ -23,6 +34,14 @@ void            cprintf(char*, ...);
 void            consoleintr(int(*)(void));
 void            panic(char*) __attribute__((noreturn));
 
+// dcache.c
+void            dcacheinit(void);
+int             dcache_lookup(struct inode*, char*, uint*);
+void            dcache_enter(struct inode*, char*, uint);
+void            dcache_remove(struct inode*, char*);
+void            dcache_purge(struct inode*);
+void            dcachedump(void);
+
 // exec.c
 int             exec(char*, char**);
 
@@ -39,12 +58,16 @@ int             filewrite(struct file*, char*, int n);
 void            xv6fs_readsb(int dev, struct superblock *sb);
 int             xv6fs_dirlink(struct inode*, char*, uint);
 struct inode*   xv6fs_dirlookup(struct inode*, char*, uint*);
+void            xv6fs_dirunlink(struct inode*, uint);
+int             xv6fs_dirempty(struct inode*);
 struct inode*   xv6fs_ialloc(uint, short);
 struct inode*   idup(struct inode*);
 void            xv6fs_iinit(int dev);
 void            xv6fs_ilock(struct inode*);
 void            xv6fs_iput(struct inode*);
 struct inode*   iget(uint, uint);
+int             idrop(struct inode*);
+short           icachetype(uint, uint);
 void            xv6fs_iunlock(struct inode*);
 void            xv6fs_iunlockput(struct inode*);
 void            xv6fs_iupdate(struct inode*);
@@ -52,6 +75,7 @@ int             namecmp(const char*, const char*);
 struct inode*   namei(char*);
 struct inode*   nameiparent(char*, char*);
 int             xv6fs_readi(struct inode*, char*, uint, uint);
+void            xv6fs_readahead(struct inode*, uint, uint);
 void            xv6fs_stati(struct inode*, struct stat*);
 int             xv6fs_writei(struct inode*, char*, uint, uint);
 
@@ -59,6 +83,8 @@ int             xv6fs_writei(struct inode*, char*, uint, uint);
 void		ext2fs_readsb(int dev, struct ext2_super_block *sb);
 int             ext2fs_dirlink(struct inode*, char*, uint);
 struct inode*   ext2fs_dirlookup(struct inode*, char*, uint*);
+void            ext2fs_dirunlink(struct inode*, uint);
+int             ext2fs_dirempty(struct inode*);
 struct inode*   ext2fs_ialloc(uint, short);
 void            ext2fs_iinit(int dev);
 void            ext2fs_ilock(struct inode*);
@@ -67,6 +93,8 @@ void            ext2fs_iunlock(struct inode*);
 void            ext2fs_iunlockput(struct inode*);
 void            ext2fs_iupdate(struct inode*);
 int             ext2fs_readi(struct inode*, char*, uint, uint);
+void            ext2fs_readahead(struct inode*, uint, uint);
+void            ext2fs_sync(int dev);
 void            ext2fs_stati(struct inode*, struct stat*);
 int             ext2fs_writei(struct inode*, char*, uint, uint);
 
@@ -74,6 +102,11 @@ int             ext2fs_writei(struct inode*, char*, uint, uint);
 void            ideinit(void);
 void            ideintr(int);
 void            iderw(struct buf*);
+void            iderw_async(struct buf*);
+void            iderw_wait(struct buf*);
+void            idetimer(void);
+void            idewatchd(void) __attribute__((noreturn));
+void            idedump(void);
 
 // ioapic.c
 void            ioapicenable(int irq, int cpu);
@@ -100,9 +133,15 @@ void            microdelay(int);
 
 // log.c
 void            initlog(int dev);
+int             initjournal(int, uint*, int, int, void (*)(int, int));
 void            log_write(struct buf*);
+void            log_revoke(int, uint);
+int             log_opblocks(int);
 void            begin_op();
 void            end_op();
+void            logflush(int);
+void            logcommitd(void) __attribute__((noreturn));
+void            logdump(void);
 
 // mp.c
 extern int      ismp;
@@ -124,6 +163,7 @@ int             cpuid(void);
 void            exit(void);
 int             fork(void);
 int             growproc(int);
+void            kthread(char*, void (*)(void));
 int             kill(int);
 struct cpu*     mycpu(void);
 struct proc*    myproc();
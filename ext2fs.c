@@ -4,6 +4,7 @@
 #include "stat.h"
 #include "mmu.h"
 #include "proc.h"
+#include "x86.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
@@ -15,6 +16,8 @@
 struct inode_operations ext2fs_inode_ops = {
         ext2fs_dirlink,
         ext2fs_dirlookup,
+        ext2fs_dirunlink,
+        ext2fs_dirempty,
         ext2fs_ialloc,
         ext2fs_iinit,
         ext2fs_ilock,
@@ -23,6 +26,7 @@ struct inode_operations ext2fs_inode_ops = {
         ext2fs_iunlockput,
         ext2fs_iupdate,
         ext2fs_readi,
+        ext2fs_readahead,
         ext2fs_stati,
         ext2fs_writei,
 };
@@ -30,13 +34,33 @@ struct inode_operations ext2fs_inode_ops = {
 #define min(a,b) ((a) < (b) ? (a) : (b))
 
 static void ext2fs_bzero(int dev, int bno);
-static uint ext2fs_balloc(uint dev, uint inum);
+static uint ext2fs_balloc(struct inode *ip, uint lbn, uint prev);
+static uint ext2fs_balloc_range(uint dev, uint goal, uint count, uint *got);
 static void ext2fs_bfree(int dev, uint b);
-static uint ext2fs_bmap(struct inode *ip, uint bn);
+static void ext2fs_bfree_range(int dev, uint b, uint count);
+static uint ext2fs_bmap(struct inode *ip, uint bn, uint want);
+static uint ext2fs_bmap_lookup(struct inode *ip, uint bn);
 static void ext2fs_itrunc(struct inode *ip);
-struct ext2fs_addrs ext2fs_addrs[NINODE];
 struct ext2_super_block ext2_sb;
 
+// In-memory copy of the block group descriptor table.
+// ext2fs_iinit() reads it once at mount time, after which
+// the allocators and inode code consult it instead of
+// re-reading the descriptor block for every operation.
+//
+// Bitmap and inode table locations never change, so they
+// may be read without the lock.  ext2_gdt.lock protects the
+// free counts here and in ext2_sb.  Changing a count only
+// marks the table dirty; ext2fs_sync() writes it back.
+struct {
+  struct spinlock lock;
+  int ngroups;
+  int dirty;
+  struct ext2_group_desc desc[EXT2_MAXGROUPS];
+  uint bhint[EXT2_MAXGROUPS];   // where the next block search starts
+  uint ihint[EXT2_MAXGROUPS];   // where the next inode search starts
+} ext2_gdt;
+
 void
 ext2fs_readsb(int dev, struct ext2_super_block *ext2_sb)
 {
@@ -46,133 +70,505 @@ ext2fs_readsb(int dev, struct ext2_super_block *ext2_sb)
   brelse(bp);
 }
 
+// Block number of the first group descriptor block.
+static uint
+ext2fs_gdtblock(void)
+{
+  return ext2_sb.s_first_data_block + 1;
+}
+
+// Read the group descriptor table into ext2_gdt.
+static void
+ext2fs_gdt_load(int dev)
+{
+  struct buf *bp;
+  int i, n;
+
+  ext2_gdt.ngroups = (ext2_sb.s_blocks_count - ext2_sb.s_first_data_block +
+                      ext2_sb.s_blocks_per_group - 1) / ext2_sb.s_blocks_per_group;
+  if(ext2_gdt.ngroups > EXT2_MAXGROUPS)
+    panic("ext2fs_gdt_load: too many groups");
+
+  for(i = 0; i < ext2_gdt.ngroups; i += n){
+    n = min(ext2_gdt.ngroups - i, EXT2_DESC_PER_BLOCK);
+    bp = bread(dev, ext2fs_gdtblock() + i / EXT2_DESC_PER_BLOCK);
+    memmove(&ext2_gdt.desc[i], bp->data, n * sizeof(struct ext2_group_desc));
+    brelse(bp);
+  }
+  ext2_gdt.dirty = 0;
+}
+
+// Return the in-memory descriptor of group gno.
+static struct ext2_group_desc*
+ext2fs_gdesc(int gno)
+{
+  if(gno < 0 || gno >= ext2_gdt.ngroups)
+    panic("ext2fs_gdesc: bad group");
+  return &ext2_gdt.desc[gno];
+}
+
+// Account for blocks, inodes and directories allocated (negative)
+// or freed (positive) in group gno.
+static void
+ext2fs_gdt_adjust(int gno, int nblocks, int ninodes, int ndirs)
+{
+  struct ext2_group_desc *gd;
+
+  gd = ext2fs_gdesc(gno);
+  acquire(&ext2_gdt.lock);
+  gd->bg_free_blocks_count += nblocks;
+  gd->bg_free_inodes_count += ninodes;
+  gd->bg_used_dirs_count += ndirs;
+  ext2_sb.s_free_blocks_count += nblocks;
+  ext2_sb.s_free_inodes_count += ninodes;
+  ext2_gdt.dirty = 1;
+  release(&ext2_gdt.lock);
+}
+
+// Copy the group descriptor table and the superblock free
+// counts into the log if they have changed.  Must be called
+// inside a transaction.
+void
+ext2fs_sync(int dev)
+{
+  struct buf *bp;
+  struct ext2_super_block *sbp;
+  int i, n;
+
+  acquire(&ext2_gdt.lock);
+  if(ext2_gdt.dirty == 0){
+    release(&ext2_gdt.lock);
+    return;
+  }
+  ext2_gdt.dirty = 0;
+  release(&ext2_gdt.lock);
+
+  for(i = 0; i < ext2_gdt.ngroups; i += n){
+    n = min(ext2_gdt.ngroups - i, EXT2_DESC_PER_BLOCK);
+    bp = bread(dev, ext2fs_gdtblock() + i / EXT2_DESC_PER_BLOCK);
+    acquire(&ext2_gdt.lock);
+    memmove(bp->data, &ext2_gdt.desc[i], n * sizeof(struct ext2_group_desc));
+    release(&ext2_gdt.lock);
+    log_write(bp);
+    brelse(bp);
+  }
+
+  bp = bread(dev, 1);
+  sbp = (struct ext2_super_block *)bp->data;
+  acquire(&ext2_gdt.lock);
+  sbp->s_free_blocks_count = ext2_sb.s_free_blocks_count;
+  sbp->s_free_inodes_count = ext2_sb.s_free_inodes_count;
+  release(&ext2_gdt.lock);
+  log_write(bp);
+  brelse(bp);
+}
+
 // Zero a block.
 static void
 ext2fs_bzero(int dev, int bno)
 {
   struct buf *bp;
 
-  bp = bread(dev, bno);
+  bp = bgetblk(dev, bno);
   memset(bp->data, 0, BSIZE);
-  bwrite(bp);
+  bdwrite(bp);
   brelse(bp);
 }
 
-// check if a block is free and return it's bit number
+// Bitmaps.
+//
+// Block and inode bitmaps are searched a 32-bit word at a
+// time: words with every bit set are skipped, and the first
+// clear bit of any other word is located with bsf.  Bit i of
+// an ext2 bitmap is bit i%8 of byte i/8, which on a
+// little-endian machine is bit i%32 of word i/32.
+
+// Return the number of the first clear bit in map at or after
+// bit start, wrapping around to bit 0, or -1 if the first
+// nbits bits are all set.  Bits at or past nbits are ignored.
+static int
+ext2fs_bitmap_find(uchar *bitmap, uint nbits, uint start)
+{
+  uint *map, nwords, w, word, bit, n;
 
-static uint
-ext2fs_free_block(char *bitmap)
-{
-  int i, j, mask;
-  for(i = 0; i < ext2_sb.s_blocks_per_group * 8; i++)
-  {
-    for(j = 0; j < 8; j++)
-    {
-      mask = 1 << (7 - j);
-      if ((bitmap[i] & mask) == 0)
-      {
-        bitmap[i] |= mask;
-        return i * 8 + j;
-      }
+  map = (uint *)bitmap;
+  if (nbits == 0)
+    return -1;
+  if (start >= nbits)
+    start = 0;
+  nwords = (nbits + 31) / 32;
+  w = start / 32;
+  // Treat bits below start in the first word as set; they
+  // are looked at last, after the search wraps around.
+  word = map[w] | (((uint)1 << (start % 32)) - 1);
+  for (n = 0; n <= nwords; n++){
+    if (word != 0xFFFFFFFF){
+      bit = w * 32 + bsf(~word);
+      if (bit < nbits)
+        return bit;
     }
+    if (++w == nwords)
+      w = 0;
+    word = map[w];
   }
   return -1;
 }
 
-// Allocate a zeroed disk block.
+// Number of blocks in group gno; the last group may be short.
 static uint
-ext2fs_balloc(uint dev, uint inum)
+ext2fs_group_nblocks(int gno)
 {
-  int gno, fbit, zbno;
-  struct ext2_group_desc bgdesc;
-  struct buf *bp1, *bp2;
+  uint first;
 
-  gno = GET_GROUP_NO(inum, ext2_sb);
-  bp1 = bread(dev, 2);
-  memmove(&bgdesc, bp1->data + gno * sizeof(bgdesc), sizeof(bgdesc));
-  brelse(bp1);
-  bp2 = bread(dev, bgdesc.bg_block_bitmap);
-
-  fbit = ext2fs_free_block((char *)bp2->data);
-  if (fbit > -1)
-  {
-    zbno = bgdesc.bg_block_bitmap + fbit;
-    bwrite(bp2);
-    ext2fs_bzero(dev, zbno);
-    brelse(bp2);
-    return zbno;
+  first = ext2_sb.s_first_data_block + gno * ext2_sb.s_blocks_per_group;
+  return min(ext2_sb.s_blocks_per_group, ext2_sb.s_blocks_count - first);
+}
+
+// Find and set a clear bit in a bitmap block holding nbits
+// bits, starting at *hint.  Advances *hint past the bit found.
+static int
+ext2fs_bitmap_alloc(uchar *bitmap, uint nbits, uint *hint)
+{
+  int bit;
+
+  nbits = min(nbits, EXT2_BSIZE * 8);
+  if ((bit = ext2fs_bitmap_find(bitmap, nbits, *hint)) < 0)
+    return -1;
+  bitmap[bit / 8] |= 1 << (bit % 8);
+  *hint = bit + 1;
+  return bit;
+}
+
+// Set up to max clear bits of bitmap starting at bit start,
+// stopping at the first bit already set or at nbits.
+// Returns the number of bits set.
+static uint
+ext2fs_bitmap_setrun(uchar *bitmap, uint nbits, uint start, uint max)
+{
+  uint n, bit;
+
+  for (n = 0; n < max && start + n < nbits; n++){
+    bit = start + n;
+    if (bitmap[bit / 8] & (1 << (bit % 8)))
+      break;
+    bitmap[bit / 8] |= 1 << (bit % 8);
+  }
+  return n;
+}
+
+// Allocate a run of up to count free blocks in group gno,
+// starting with the first free block at or after index start.
+// The bitmap block is read and written once for the whole run.
+// Returns the first block number and sets *got to the length
+// of the run, or returns 0 if the group is full.
+static uint
+ext2fs_balloc_group(uint dev, int gno, uint start, uint count, uint *got)
+{
+  int bit;
+  uint nbits;
+  struct buf *bp;
+
+  nbits = min(ext2fs_group_nblocks(gno), EXT2_BSIZE * 8);
+  bp = bread(dev, ext2fs_gdesc(gno)->bg_block_bitmap);
+  if ((bit = ext2fs_bitmap_find(bp->data, nbits, start)) < 0){
+    brelse(bp);
+    return 0;
+  }
+  *got = ext2fs_bitmap_setrun(bp->data, nbits, bit, count);
+  ext2_gdt.bhint[gno] = bit + *got;
+  log_write(bp);
+  brelse(bp);
+  ext2fs_gdt_adjust(gno, -*got, 0, 0);
+  return ext2_sb.s_first_data_block + gno * ext2_sb.s_blocks_per_group + bit;
+}
+
+// Allocate a run of up to count contiguous blocks, as close
+// after block goal as possible.  Searches forward through
+// goal's group first, and then the other groups, those with
+// the most free blocks first.  Returns the first block of the
+// run and sets *got to its length, which is at least 1.
+static uint
+ext2fs_balloc_range(uint dev, uint goal, uint count, uint *got)
+{
+  int g, gno;
+  uint b, start;
+  char tried[EXT2_MAXGROUPS];
+
+  if (goal < ext2_sb.s_first_data_block || goal >= ext2_sb.s_blocks_count)
+    goal = ext2_sb.s_first_data_block;
+  gno = GET_BLOCK_GROUP(goal, ext2_sb);
+  start = GET_BLOCK_INDEX(goal, ext2_sb);
+
+  memset(tried, 0, sizeof(tried));
+  tried[gno] = 1;
+  while ((b = ext2fs_balloc_group(dev, gno, start, count, got)) == 0){
+    gno = -1;
+    for (g = 0; g < ext2_gdt.ngroups; g++){
+      if (tried[g] || ext2fs_gdesc(g)->bg_free_blocks_count == 0)
+        continue;
+      if (gno < 0 ||
+          ext2fs_gdesc(g)->bg_free_blocks_count > ext2fs_gdesc(gno)->bg_free_blocks_count)
+        gno = g;
+    }
+    if (gno < 0)
+      panic("ext2_balloc: out of blocks\n");
+    tried[gno] = 1;
+    start = ext2_gdt.bhint[gno];
+  }
+  return b;
+}
+
+// Choose where logical block lbn of ip should go: right after
+// prev, the physical block preceding it in the file.  If the
+// caller does not know prev, use the last block allocated to
+// the file, and failing that the inode's own group.
+static uint
+ext2fs_find_goal(struct inode *ip, uint lbn, uint prev)
+{
+  int gno;
+  struct ext2fs_addrs *ad;
+
+  ad = (struct ext2fs_addrs *)ip->addrs;
+  if (prev == 0 && lbn != 0){
+    prev = ad->last_pbn;
+    if (prev == 0 && lbn <= EXT2_NDIR_BLOCKS)
+      prev = ad->addrs[lbn - 1];
   }
-  brelse(bp2);
-  panic("ext2_balloc: out of blocks\n");
+  if (prev != 0)
+    return prev + 1;
+
+  gno = GET_GROUP_NO(ip->inum, ext2_sb);
+  return ext2_sb.s_first_data_block + gno * ext2_sb.s_blocks_per_group +
+         ext2_gdt.bhint[gno] % ext2fs_group_nblocks(gno);
+}
+
+// Preallocation.
+//
+// A regular file that allocates a block also reserves the next
+// few blocks after it, and its later appends are handed those
+// blocks without searching the bitmap again.  Appenders that
+// take turns writing small pieces then still get contiguous
+// files.  The reservation is marked in the bitmap but not yet
+// mapped into the file; it lives in the inode's ext2fs_addrs
+// and is given back by ext2fs_discard_prealloc() when the
+// last reference to the inode is dropped.
+
+// How many blocks to reserve beyond those asked for.
+static uint
+ext2fs_prealloc_blocks(struct inode *ip)
+{
+  if (ip->type == T_DIR){
+    if (ext2_sb.s_feature_compat & EXT2_FEATURE_COMPAT_DIR_PREALLOC)
+      return ext2_sb.s_prealloc_dir_blocks;
+    return 0;
+  }
+  if (ext2_sb.s_prealloc_blocks)
+    return ext2_sb.s_prealloc_blocks;
+  return EXT2_DEFAULT_PREALLOC_BLOCKS;
+}
+
+// Return ip's unused preallocated blocks to the free pool.
+// Caller must hold ip->lock.
+static void
+ext2fs_discard_prealloc(struct inode *ip)
+{
+  struct ext2fs_addrs *ad;
+
+  ad = (struct ext2fs_addrs *)ip->addrs;
+  if (ad->prealloc_count > 0)
+    ext2fs_bfree_range(ip->dev, ad->prealloc_start, ad->prealloc_count);
+  ad->prealloc_start = 0;
+  ad->prealloc_count = 0;
+}
+
+// Allocate a run of up to count blocks for ip at goal, from
+// the inode's preallocation window if the window starts there.
+// Returns the first block and sets *got to the run length.
+static uint
+ext2fs_balloc_ip(struct inode *ip, uint goal, uint count, uint *got)
+{
+  uint b, n;
+  struct ext2fs_addrs *ad;
+
+  ad = (struct ext2fs_addrs *)ip->addrs;
+  if (ad->prealloc_count > 0){
+    if (ad->prealloc_start == goal){
+      b = ad->prealloc_start;
+      *got = min(count, ad->prealloc_count);
+      ad->prealloc_start += *got;
+      ad->prealloc_count -= *got;
+      ad->last_pbn = b + *got - 1;
+      return b;
+    }
+    // The file is no longer being written where the window is.
+    ext2fs_discard_prealloc(ip);
+  }
+
+  b = ext2fs_balloc_range(ip->dev, goal, count + ext2fs_prealloc_blocks(ip), &n);
+  *got = min(count, n);
+  if (n > *got){
+    ad->prealloc_start = b + *got;
+    ad->prealloc_count = n - *got;
+  }
+  ad->last_pbn = b + *got - 1;
+  return b;
+}
+
+// Allocate a zeroed disk block for logical block lbn of ip.
+// prev is the physical block preceding it in the file, or 0
+// if the caller does not know it.  Keeping a file's blocks in
+// order on disk means a sequential read does not have to seek.
+static uint
+ext2fs_balloc(struct inode *ip, uint lbn, uint prev)
+{
+  uint b, got;
+
+  b = ext2fs_balloc_ip(ip, ext2fs_find_goal(ip, lbn, prev), 1, &got);
+  ext2fs_bzero(ip->dev, b);
+  return b;
+}
+
+// Free count contiguous blocks starting at b, which must all
+// lie in one group.
+static void
+ext2fs_bfree_range(int dev, uint b, uint count)
+{
+  int gno, bindex, mask;
+  uint i;
+  struct buf *bp;
+
+  gno = GET_BLOCK_GROUP(b, ext2_sb);
+  bp = bread(dev, ext2fs_gdesc(gno)->bg_block_bitmap);
+  for (i = 0; i < count; i++){
+    bindex = GET_BLOCK_INDEX(b + i, ext2_sb);
+    mask = 1 << (bindex % 8);
+    if ((bp->data[bindex / 8] & mask) == 0)
+      panic("ext2fs_bfree: block already free\n");
+    bp->data[bindex / 8] = bp->data[bindex / 8] & ~mask;
+    log_revoke(dev, b + i);
+  }
+  log_write(bp);
+  brelse(bp);
+  ext2fs_gdt_adjust(gno, count, 0, 0);
 }
 
 // Free a disk block.
 static void
 ext2fs_bfree(int dev, uint b)
 {
-  int gno, iindex, mask;
-  struct ext2_group_desc bgdesc;
-  struct buf *bp1, *bp2;
+  ext2fs_bfree_range(dev, b, 1);
+}
 
-  gno = GET_GROUP_NO(b, ext2_sb);
-  iindex = GET_INODE_INDEX(b, ext2_sb);
-  bp1 = bread(dev, 2);
-  memmove(&bgdesc, bp1->data + gno * sizeof(bgdesc), sizeof(bgdesc));
-  bp2 = bread(dev, bgdesc.bg_block_bitmap);
-  iindex -= bgdesc.bg_block_bitmap;
-  mask = 1 << (iindex % 8);
-
-  if ((bp2->data[iindex / 8] & mask) == 0)
-    panic("ext2fs_bfree: block already free\n");
-  bp2->data[iindex / 8] = bp2->data[iindex / 8] & ~mask;
-  bwrite(bp2);
-  brelse(bp2);
-  brelse(bp1);
+// Set or clear the superblock's needs-recovery flag, which
+// tells Linux and e2fsck to replay the journal.  The log calls
+// this with no FS sys calls executing, so the superblock in
+// the cache holds only committed changes.
+static void
+ext2fs_setrecover(int dev, int on)
+{
+  struct buf *bp;
+  struct ext2_super_block *sbp;
+
+  bp = bread(dev, 1);
+  sbp = (struct ext2_super_block *)bp->data;
+  if(on)
+    sbp->s_feature_incompat |= EXT3_FEATURE_INCOMPAT_RECOVER;
+  else
+    sbp->s_feature_incompat &= ~EXT3_FEATURE_INCOMPAT_RECOVER;
+  ext2_sb.s_feature_incompat = sbp->s_feature_incompat;
+  bwrite(bp);
+  brelse(bp);
+}
+
+// Log metadata to the file system's journal, if it has one
+// we can use.  The journal's blocks never move, so a map of
+// them is all that is kept; a journal with holes is refused
+// rather than filled in.
+static void
+ext2fs_journal_init(int dev)
+{
+  struct inode *ip;
+  uint *map;
+  int i, n;
+
+  if((ext2_sb.s_feature_compat & EXT3_FEATURE_COMPAT_HAS_JOURNAL) == 0 ||
+     ext2_sb.s_journal_inum == 0)
+    return;
+  if((map = (uint*)kalloc()) == 0)
+    panic("ext2fs_journal_init");
+
+  ip = iget(dev, ext2_sb.s_journal_inum);
+  ip->iops->ilock(ip);
+  n = min(ip->size / EXT2_BSIZE, PGSIZE / sizeof(uint));
+  for(i = 0; i < n; i++)
+    if((map[i] = ext2fs_bmap_lookup(ip, i)) == 0)
+      break;
+  ip->iops->iunlockput(ip);
+
+  if(i < n){
+    cprintf("ext2fs: journal on dev %d has holes\n", dev);
+    kfree((char*)map);
+    return;
+  }
+  if(n == 0 || initjournal(dev, map, n, EXT2_MAXOPBLOCKS, ext2fs_setrecover) == 0)
+    kfree((char*)map);
 }
 
 void
 ext2fs_iinit(int dev)
 {
+  initlock(&ext2_gdt.lock, "ext2gdt");
+  ext2fs_readsb(dev, &ext2_sb);
+  ext2fs_gdt_load(dev);
+  ext2fs_journal_init(dev);
+  // Replaying the journal may have rewritten the superblock
+  // and group descriptors; read them again so that sync does
+  // not put the old free counts back.
   ext2fs_readsb(dev, &ext2_sb);
+  ext2fs_gdt_load(dev);
   cprintf("ext2_sb: magic_number %x size %d nblocks %d ninodes %d \
 inodes_per_group %d inode_size %d\n", ext2_sb.s_magic, 1024<<ext2_sb.s_log_block_size,
   ext2_sb.s_blocks_count, ext2_sb.s_inodes_count, ext2_sb.s_inodes_per_group,
   ext2_sb.s_inode_size);
+  cprintf("ext2_gdt: ngroups %d free blocks %d free inodes %d\n",
+  ext2_gdt.ngroups, ext2_sb.s_free_blocks_count, ext2_sb.s_free_inodes_count);
 }
 
 struct inode*
 ext2fs_ialloc(uint dev, short type)
 {
-  int i, fbit, bno, iindex, bgcount, inum;
-  struct buf *bp1, *bp2, *bp3;
+  int i, fbit, bno, iindex, inum;
+  struct buf *bp1, *bp2;
   struct ext2_inode *din;
-  struct ext2_group_desc bgdesc;
+  struct ext2_group_desc *gd;
 
-  bgcount = ext2_sb.s_blocks_count / ext2_sb.s_blocks_per_group;
-  for (i = 0; i <= bgcount; i++){
-    bp1 = bread(dev, 2);
-    memmove(&bgdesc, bp1->data + i * sizeof(bgdesc), sizeof(bgdesc));
-    brelse(bp1);
+  for (i = 0; i < ext2_gdt.ngroups; i++){
+    gd = ext2fs_gdesc(i);
+    if (gd->bg_free_inodes_count == 0)
+      continue;
 
-    bp2 = bread(dev, bgdesc.bg_inode_bitmap);
-    fbit = ext2fs_free_block((char *)bp2->data);
+    bp1 = bread(dev, gd->bg_inode_bitmap);
+    fbit = ext2fs_bitmap_alloc(bp1->data, ext2_sb.s_inodes_per_group,
+                               &ext2_gdt.ihint[i]);
     if (fbit == -1){
-      brelse(bp2);
+      brelse(bp1);
       continue;
     }
 
-    bno = bgdesc.bg_inode_table + fbit / (EXT2_BSIZE / sizeof(struct ext2_inode));    iindex = fbit % (EXT2_BSIZE / sizeof(struct ext2_inode));
-    bp3 = bread(dev, bno);
-    din = (struct ext2_inode *)bp3->data + iindex;
+    bno = gd->bg_inode_table + fbit / (EXT2_BSIZE / ext2_sb.s_inode_size);
+    iindex = fbit % (EXT2_BSIZE / ext2_sb.s_inode_size);
+    bp2 = bread(dev, bno);
+    din = (struct ext2_inode *)(bp2->data + iindex * ext2_sb.s_inode_size);
     memset(din, 0, sizeof(*din));
     if (type == T_DIR)
       din->i_mode = S_IFDIR;
     else if (type == T_FILE)
       din->i_mode = S_IFREG;
-    bwrite(bp3);
-    bwrite(bp2);
-    brelse(bp3);
+    log_write(bp2);
+    log_write(bp1);
     brelse(bp2);
+    brelse(bp1);
+    ext2fs_gdt_adjust(i, 0, -1, type == T_DIR);
 
     inum = i * ext2_sb.s_inodes_per_group + fbit + 1;
     return iget(dev, inum);
@@ -183,18 +579,14 @@ ext2fs_ialloc(uint dev, short type)
 void
 ext2fs_iupdate(struct inode *ip)
 {
-  struct buf *bp, *bp1;
-  struct ext2_group_desc bgdesc;
+  struct buf *bp1;
   struct ext2_inode din;
   struct ext2fs_addrs *ad;
   int gno, ioff, bno, iindex;
 
   gno = GET_GROUP_NO(ip->inum, ext2_sb);
   ioff = GET_INODE_INDEX(ip->inum, ext2_sb);
-  bp = bread(ip->dev, 2);
-  memmove(&bgdesc, bp->data + gno * sizeof(bgdesc), sizeof(bgdesc));
-  brelse(bp);
-  bno = bgdesc.bg_inode_table + ioff / (EXT2_BSIZE / ext2_sb.s_inode_size);
+  bno = ext2fs_gdesc(gno)->bg_inode_table + ioff / (EXT2_BSIZE / ext2_sb.s_inode_size);
   iindex = ioff % (EXT2_BSIZE / ext2_sb.s_inode_size);
   bp1 = bread(ip->dev, bno);
   memmove(&din, bp1->data + iindex * ext2_sb.s_inode_size, sizeof(din));
@@ -208,7 +600,7 @@ ext2fs_iupdate(struct inode *ip)
   din.i_dtime = 0;
   din.i_faddr = 0;
   din.i_file_acl = 0;
-  din.i_flags = 0;
+  din.i_flags = ((struct ext2fs_addrs *)ip->addrs)->flags;
   din.i_generation = 0;
   din.i_gid = 0;
   din.i_mtime = 0;
@@ -218,15 +610,14 @@ ext2fs_iupdate(struct inode *ip)
   ad = (struct ext2fs_addrs *)ip->addrs;
   memmove(din.i_block, ad->addrs, sizeof(ad->addrs));
   memmove(bp1->data + (iindex * ext2_sb.s_inode_size), &din, sizeof(din));
-  bwrite(bp1);
+  log_write(bp1);
   brelse(bp1);
 }
 
 void
 ext2fs_ilock(struct inode *ip)
 {
-  struct buf *bp, *bp1;
-  struct ext2_group_desc bgdesc;
+  struct buf *bp1;
   struct ext2_inode din;
   struct ext2fs_addrs *ad;
   int gno, ioff, bno, iindex;
@@ -239,10 +630,7 @@ ext2fs_ilock(struct inode *ip)
   if (ip->valid == 0){
     gno = GET_GROUP_NO(ip->inum, ext2_sb);
     ioff = GET_INODE_INDEX(ip->inum, ext2_sb);
-    bp = bread(ip->dev, 2);
-    memmove(&bgdesc, bp->data + gno * sizeof(bgdesc), sizeof(bgdesc));
-    brelse(bp);
-    bno = bgdesc.bg_inode_table + ioff / (EXT2_BSIZE / ext2_sb.s_inode_size);
+    bno = ext2fs_gdesc(gno)->bg_inode_table + ioff / (EXT2_BSIZE / ext2_sb.s_inode_size);
     iindex = ioff % (EXT2_BSIZE / ext2_sb.s_inode_size);
     bp1 = bread(ip->dev, bno);
     memmove(&din, bp1->data + iindex * ext2_sb.s_inode_size, sizeof(din));
@@ -258,6 +646,10 @@ ext2fs_ilock(struct inode *ip)
     ip->size = din.i_size;
     ip->iops = &ext2fs_inode_ops;
     memmove(ad->addrs, din.i_block, sizeof(ad->addrs));
+    ad->last_pbn = 0;
+    ad->prealloc_start = 0;
+    ad->prealloc_count = 0;
+    ad->flags = din.i_flags;
 
     ip->valid = 1;
     if (ip->type == 0)
@@ -280,34 +672,33 @@ static void
 ext2fs_ifree(struct inode *ip)
 {
   int gno, index, mask;
-  struct ext2_group_desc bgdesc;
-  struct buf *bp1, *bp2;
+  struct buf *bp;
 
   gno = GET_GROUP_NO(ip->inum, ext2_sb);
-  bp1 = bread(ip->dev, 2);
-  memmove(&bgdesc, bp1->data + gno * sizeof(bgdesc), sizeof(bgdesc));
-  brelse(bp1);
-  bp2 = bread(ip->dev, bgdesc.bg_inode_bitmap);
-  index = (ip->inum - 1) % ext2_sb.s_inodes_per_group;
+  bp = bread(ip->dev, ext2fs_gdesc(gno)->bg_inode_bitmap);
+  index = GET_INODE_INDEX(ip->inum, ext2_sb);
   mask = 1 << (index % 8);
 
-  if ((bp2->data[index / 8] & mask) == 0)
+  if ((bp->data[index / 8] & mask) == 0)
     panic("ext2fs_ifree: inode already free\n");
-  bp2->data[index / 8] = bp2->data[index / 8] & ~mask;
-  bwrite(bp2);
-  brelse(bp2);
+  bp->data[index / 8] = bp->data[index / 8] & ~mask;
+  log_write(bp);
+  brelse(bp);
+  ext2fs_gdt_adjust(gno, 0, 1, -(ip->type == T_DIR));
 }
 
 void
 ext2fs_iput(struct inode *ip)
 {
-  struct ext2fs_addrs *ad;
+  uint dev;
+  int r;
   acquiresleep(&ip->lock);
-  ad = (struct ext2fs_addrs *)ip->addrs;
+  acquire(&icache.lock);
+  r = ip->ref;
+  release(&icache.lock);
+  if(ip->valid && r == 1)
+    ext2fs_discard_prealloc(ip);
   if(ip->valid && ip->nlink == 0){
-    acquire(&icache.lock);
-    int r = ip->ref;
-    release(&icache.lock);
     if(r == 1){
       // inode has no links and no other references: truncate and free.
       ext2fs_ifree(ip);
@@ -321,15 +712,12 @@ ext2fs_iput(struct inode *ip)
   }
   releasesleep(&ip->lock);
 
-  acquire(&icache.lock);
-  ip->ref--;
-  if (ip->ref == 0){
-    ad->busy = 0;
-    ip->addrs = 0;
-  }
-  release(&icache.lock);
-
-  return;
+  // Write back the free counts once the last user of the
+  // inode is gone rather than after every allocation.  Once
+  // the entry is dropped it may be recycled.
+  dev = ip->dev;
+  if (idrop(ip) == 0)
+    ext2fs_sync(dev);
 }
 
 void
@@ -356,8 +744,36 @@ ext2fs_stati(struct inode *ip, struct stat *st)
 // are listed in ip->addrs[].  The next NINDIRECT blocks are
 // listed in block ip->addrs[NDIRECT].
 
+// Return entry i of the indirect block at addr.  If the entry
+// is empty, fill it with want if that is non-zero, or else
+// allocate a block for logical block lbn.  A data block (leaf)
+// is placed after the data block in entry i-1, or after the
+// indirect block itself for the first entry.
+static uint
+ext2fs_bmap_ind(struct inode *ip, uint addr, uint i, uint lbn, int leaf, uint want)
+{
+  uint *a, prev;
+  struct buf *bp;
+
+  bp = bread(ip->dev, addr);
+  a = (uint *)bp->data;
+  if ((addr = a[i]) == 0){
+    if (want == 0){
+      prev = 0;
+      if (leaf)
+        prev = i > 0 ? a[i - 1] : bp->blockno;
+      want = ext2fs_balloc(ip, lbn, prev);
+    }
+    a[i] = addr = want;
+    log_write(bp);
+  }
+  brelse(bp);
+  return addr;
+}
+
 // Return the disk block address of the nth block in inode ip.
-// If there is no such block, bmap allocates one.
+// If there is no such block, bmap maps want there, or
+// allocates one if want is 0.
   /*
    * EXT2BSIZE -> 1024
    * If < EXT2_NDIR_BLOCKS then it is directly mapped, allocate and return
@@ -367,69 +783,111 @@ ext2fs_stati(struct inode *ip, struct stat *st)
    * Else panic()
   */
 static uint
-ext2fs_bmap(struct inode *ip, uint bn)
+ext2fs_bmap(struct inode *ip, uint bn, uint want)
 {
-  uint addr, *a, *b, *c;
-  struct buf *bp, *bp1, *bp2;
+  uint addr, lbn;
   struct ext2fs_addrs *ad;
   ad = (struct ext2fs_addrs *)ip->addrs;
+  lbn = bn;
 
   if (bn < EXT2_NDIR_BLOCKS){
-    if ((addr = ad->addrs[bn]) == 0)
-      ad->addrs[bn] = addr = ext2fs_balloc(ip->dev, ip->inum);
+    if ((addr = ad->addrs[bn]) == 0){
+      if (want == 0)
+        want = ext2fs_balloc(ip, lbn, bn > 0 ? ad->addrs[bn - 1] : 0);
+      ad->addrs[bn] = addr = want;
+    }
     return addr;
   }
   bn -= EXT2_NDIR_BLOCKS;
+
   if (bn < EXT2_INDIRECT){
     if ((addr = ad->addrs[EXT2_IND_BLOCK]) == 0)
-      ad->addrs[EXT2_IND_BLOCK] = addr = ext2fs_balloc(ip->dev, ip->inum);
-    bp = bread(ip->dev, addr);
-    a = (uint *)bp->data;
-    if ((addr = a[bn]) == 0)
-      a[bn] = addr = ext2fs_balloc(ip->dev, ip->inum);
-    brelse(bp);
-    return addr;
+      ad->addrs[EXT2_IND_BLOCK] = addr =
+        ext2fs_balloc(ip, lbn, ad->addrs[EXT2_NDIR_BLOCKS - 1]);
+    return ext2fs_bmap_ind(ip, addr, bn, lbn, 1, want);
   }
   bn -= EXT2_INDIRECT;
 
   if (bn < EXT2_DINDIRECT){
     if ((addr = ad->addrs[EXT2_DIND_BLOCK]) == 0)
-      ad->addrs[EXT2_DIND_BLOCK] = addr = ext2fs_balloc(ip->dev, ip->inum);
-    bp = bread(ip->dev, addr);
-    a = (uint *)bp->data;
-    if ((addr = a[bn / EXT2_INDIRECT]) == 0)
-      a[bn / EXT2_INDIRECT] = addr = ext2fs_balloc(ip->dev, ip->inum);
-    bp1 = bread(ip->dev, addr);
-    b = (uint *)bp1->data;
-    if ((addr = b[bn / EXT2_INDIRECT]) == 0)
-      b[bn / EXT2_INDIRECT] = addr = ext2fs_balloc(ip->dev, ip->inum);
-    brelse(bp);
-    brelse(bp1);
-    return addr;
+      ad->addrs[EXT2_DIND_BLOCK] = addr = ext2fs_balloc(ip, lbn, 0);
+    addr = ext2fs_bmap_ind(ip, addr, bn / EXT2_INDIRECT, lbn, 0, 0);
+    return ext2fs_bmap_ind(ip, addr, bn % EXT2_INDIRECT, lbn, 1, want);
   }
   bn -= EXT2_DINDIRECT;
 
   if (bn < EXT2_TINDIRECT){
     if ((addr = ad->addrs[EXT2_TIND_BLOCK]) == 0)
-      ad->addrs[EXT2_TIND_BLOCK] = addr = ext2fs_balloc(ip->dev, ip->inum);
+      ad->addrs[EXT2_TIND_BLOCK] = addr = ext2fs_balloc(ip, lbn, 0);
+    addr = ext2fs_bmap_ind(ip, addr, bn / EXT2_DINDIRECT, lbn, 0, 0);
+    addr = ext2fs_bmap_ind(ip, addr, (bn / EXT2_INDIRECT) % EXT2_INDIRECT, lbn, 0, 0);
+    return ext2fs_bmap_ind(ip, addr, bn % EXT2_INDIRECT, lbn, 1, want);
+  }
+  panic("ext2_bmap: block number out of range\n");
+}
+
+// Return the disk block address of the nth block in inode ip,
+// or 0 if it is a hole.  Never allocates, so the read paths
+// can use it outside a transaction.
+static uint
+ext2fs_bmap_lookup(struct inode *ip, uint bn)
+{
+  uint addr, idx[3];
+  int i, n;
+  struct buf *bp;
+  struct ext2fs_addrs *ad;
+  ad = (struct ext2fs_addrs *)ip->addrs;
+
+  if (bn < EXT2_NDIR_BLOCKS)
+    return ad->addrs[bn];
+  bn -= EXT2_NDIR_BLOCKS;
+
+  if (bn < EXT2_INDIRECT){
+    addr = ad->addrs[EXT2_IND_BLOCK];
+    idx[0] = bn;
+    n = 1;
+  } else if ((bn -= EXT2_INDIRECT) < EXT2_DINDIRECT){
+    addr = ad->addrs[EXT2_DIND_BLOCK];
+    idx[0] = bn / EXT2_INDIRECT;
+    idx[1] = bn % EXT2_INDIRECT;
+    n = 2;
+  } else if ((bn -= EXT2_DINDIRECT) < EXT2_TINDIRECT){
+    addr = ad->addrs[EXT2_TIND_BLOCK];
+    idx[0] = bn / EXT2_DINDIRECT;
+    idx[1] = (bn / EXT2_INDIRECT) % EXT2_INDIRECT;
+    idx[2] = bn % EXT2_INDIRECT;
+    n = 3;
+  } else
+    panic("ext2_bmap_lookup: block number out of range\n");
+
+  for (i = 0; i < n && addr != 0; i++){
     bp = bread(ip->dev, addr);
-    a = (uint *)bp->data;
-    if ((addr = a[bn / EXT2_INDIRECT]) == 0)
-      a[bn / EXT2_INDIRECT] = addr = ext2fs_balloc(ip->dev, ip->inum);
-    bp1 = bread(ip->dev, addr);
-    b = (uint *)bp1->data;
-    if ((addr = b[bn / EXT2_INDIRECT]) == 0)
-      b[bn / EXT2_INDIRECT] = addr = ext2fs_balloc(ip->dev, ip->inum);
-    bp2 = bread(ip->dev, addr);
-    c = (uint *)bp2->data;
-    if ((addr = c[bn / EXT2_INDIRECT]) == 0)
-      c[bn / EXT2_INDIRECT] = addr = ext2fs_balloc(ip->dev, ip->inum);
+    addr = ((uint *)bp->data)[idx[i]];
     brelse(bp);
-    brelse(bp1);
-    brelse(bp2);
-    return addr;
   }
-  panic("ext2_bmap: block number out of range\n");
+  return addr;
+}
+
+// Map logical blocks lbn .. lbn+count-1 of ip, which lie past
+// the end of the file, allocating them in as few contiguous
+// runs as free space allows.  Used by writei for appends so a
+// large write costs one bitmap update per run, not per block.
+// The new data blocks are not zeroed: writei fills every one
+// of them completely before writing it.
+static void
+ext2fs_bmap_range(struct inode *ip, uint lbn, uint count)
+{
+  uint b, got, i;
+
+  while (count > 0){
+    b = ext2fs_balloc_ip(ip, ext2fs_find_goal(ip, lbn, 0), count, &got);
+    for (i = 0; i < got; i++){
+      if (ext2fs_bmap(ip, lbn + i, b + i) != b + i)
+        ext2fs_bfree(ip->dev, b + i);  // already mapped
+    }
+    lbn += got;
+    count -= got;
+  }
 }
 
 // Truncate inode (discard contents).
@@ -533,7 +991,7 @@ ext2fs_itrunc(struct inode *ip)
 int
 ext2fs_readi(struct inode *ip, char *dst, uint off, uint n)
 {
-  uint tot, m;
+  uint tot, m, addr;
   struct buf *bp;
 
   if(ip->type == T_DEV){
@@ -548,18 +1006,41 @@ ext2fs_readi(struct inode *ip, char *dst, uint off, uint n)
     n = ip->size - off;
 
   for(tot = 0; tot < n; tot += m, off += m, dst += m){
-    bp = bread(ip->dev, ext2fs_bmap(ip, off / EXT2_BSIZE));
     m = min(n - tot, EXT2_BSIZE - off % EXT2_BSIZE);
+    if((addr = ext2fs_bmap_lookup(ip, off / EXT2_BSIZE)) == 0){
+      memset(dst, 0, m);  // a hole reads as zeroes
+      continue;
+    }
+    bp = bread(ip->dev, addr);
     memmove(dst, bp->data + off % EXT2_BSIZE, m);
     brelse(bp);
   }
   return n;
 }
 
+// Start reading the blocks holding bytes off..off+n-1 of ip
+// into the buffer cache, without waiting for them.
+// Caller must hold ip->lock.
+void
+ext2fs_readahead(struct inode *ip, uint off, uint n)
+{
+  uint bn, end, addr;
+
+  if(ip->type == T_DEV || off >= ip->size)
+    return;
+  if(off + n > ip->size || off + n < off)
+    n = ip->size - off;
+
+  end = (off + n + EXT2_BSIZE - 1) / EXT2_BSIZE;
+  for(bn = off / EXT2_BSIZE; bn < end; bn++)
+    if((addr = ext2fs_bmap_lookup(ip, bn)) != 0)
+      breada(ip->dev, addr);
+}
+
 int
 ext2fs_writei(struct inode *ip, char *src, uint off, uint n)
 {
-  uint tot, m;
+  uint tot, m, lbn, newlbn, end;
   struct buf *bp;
 
   if(ip->type == T_DEV){
@@ -573,11 +1054,31 @@ ext2fs_writei(struct inode *ip, char *src, uint off, uint n)
   if(off + n > EXT2_MAXFILE*EXT2_BSIZE)
     return -1;
 
+  // Allocate all the blocks an append needs up front, so they
+  // come out of the bitmap in contiguous runs.
+  newlbn = (ip->size + EXT2_BSIZE - 1) / EXT2_BSIZE;
+  end = (off + n + EXT2_BSIZE - 1) / EXT2_BSIZE;
+  if(end > newlbn)
+    ext2fs_bmap_range(ip, newlbn, end - newlbn);
+
   for(tot=0; tot<n; tot+=m, off+=m, src+=m){
-    bp = bread(ip->dev, ext2fs_bmap(ip, off / EXT2_BSIZE));
+    lbn = off / EXT2_BSIZE;
     m = min(n - tot, EXT2_BSIZE - off%EXT2_BSIZE);
+    // Blocks that are overwritten entirely, or that were just
+    // allocated, hold nothing worth reading from disk.
+    if(m == EXT2_BSIZE || lbn >= newlbn){
+      bp = bgetblk(ip->dev, ext2fs_bmap(ip, lbn, 0));
+      if(m < EXT2_BSIZE)
+        memset(bp->data, 0, EXT2_BSIZE);
+    } else
+      bp = bread(ip->dev, ext2fs_bmap(ip, lbn, 0));
     memmove(bp->data + off%EXT2_BSIZE, src, m);
-    bwrite(bp);
+    // Directories are metadata, and go through the journal;
+    // file data is written back before the commit instead.
+    if(ip->type == T_DIR)
+      log_write(bp);
+    else
+      bdwrite(bp);
     brelse(bp);
   }
 
@@ -588,61 +1089,858 @@ ext2fs_writei(struct inode *ip, char *src, uint off, uint n)
   return n;
 }
 
-int
-ext2fs_namecmp(const char *s, const char *t)
+//PAGEBREAK!
+// Directories.
+//
+// A directory is a sequence of blocks, each a chain of
+// entries linked by rec_len, the last of which runs to the
+// end of the block.  An entry with inode 0 is unused.
+//
+// If the file system has the dir_index feature, a directory
+// that outgrows its first block gets an HTree index, as in
+// Linux.  Block 0 becomes the root of the index: "." and
+// "..", the latter stretched to the end of the block, and
+// hidden in its slack a sorted table of (hash, block) pairs.
+// Each pair says that names hashing at or above hash are in
+// block, or below it, an index block of the same kind with
+// an empty entry for a header.  The other blocks are leaves,
+// which are ordinary directory blocks, so that a directory
+// with an index can still be read as a plain one.  When a
+// leaf fills up, its upper half by hash moves to a new leaf.
+
+// Entry at byte off of directory block bp.
+#define DIRENT(bp, off) ((struct ext2_dir_entry_2 *)((bp)->data + (off)))
+
+// A step down an HTree: an index block and the entry taken.
+struct dx_frame {
+  uint lbn;
+  int at;
+};
+
+// The path from the root of an HTree to the leaf for a name.
+struct dx_path {
+  struct dx_frame frame[EXT2_DX_MAXLEVELS];
+  int nframe;
+  int version;     // hash function
+  uint hash;       // of the name
+  uint leaf;       // leaf block
+};
+
+static uint
+rol32(uint x, int s)
 {
-  return strncmp(s, t, EXT2_NAME_LEN);
+  return (x << s) | (x >> (32 - s));
 }
 
+// The original dir_index hash.
+static uint
+ext2fs_dx_hack_hash(const char *name, int len, int unsig)
+{
+  uint hash, hash0 = 0x12a3fe2d, hash1 = 0x37abe8f9;
+  int c;
+
+  while (len--){
+    c = unsig ? (uchar)*name : (signed char)*name;
+    name++;
+    hash = hash1 + (hash0 ^ (c * 7152373));
+    if (hash & 0x80000000)
+      hash -= 0x7fffffff;
+    hash1 = hash0;
+    hash0 = hash;
+  }
+  return hash0 << 1;
+}
+
+// Pack up to num*4 bytes of msg into num words, padded with
+// the length.
+static void
+ext2fs_str2hashbuf(const char *msg, int len, uint *buf, int num, int unsig)
+{
+  uint pad, val;
+  int i, c;
+
+  pad = (uint)len | ((uint)len << 8);
+  pad |= pad << 16;
+  val = pad;
+  if (len > num * 4)
+    len = num * 4;
+  for (i = 0; i < len; i++){
+    c = unsig ? (uchar)msg[i] : (signed char)msg[i];
+    val = c + (val << 8);
+    if ((i % 4) == 3){
+      *buf++ = val;
+      val = pad;
+      num--;
+    }
+  }
+  if (--num >= 0)
+    *buf++ = val;
+  while (--num >= 0)
+    *buf++ = pad;
+}
+
+#define F(x, y, z) ((z) ^ ((x) & ((y) ^ (z))))
+#define G(x, y, z) (((x) & (y)) + (((x) ^ (y)) & (z)))
+#define H(x, y, z) ((x) ^ (y) ^ (z))
+#define ROUND(f, a, b, c, d, x, s) (a += f(b, c, d) + (x), a = rol32(a, s))
+#define K2 013240474631U
+#define K3 015666365641U
+
+// Half of an MD4 transform, as in Linux.
+static void
+ext2fs_half_md4(uint buf[4], uint in[8])
+{
+  uint a = buf[0], b = buf[1], c = buf[2], d = buf[3];
+
+  ROUND(F, a, b, c, d, in[0], 3);
+  ROUND(F, d, a, b, c, in[1], 7);
+  ROUND(F, c, d, a, b, in[2], 11);
+  ROUND(F, b, c, d, a, in[3], 19);
+  ROUND(F, a, b, c, d, in[4], 3);
+  ROUND(F, d, a, b, c, in[5], 7);
+  ROUND(F, c, d, a, b, in[6], 11);
+  ROUND(F, b, c, d, a, in[7], 19);
+
+  ROUND(G, a, b, c, d, in[1] + K2, 3);
+  ROUND(G, d, a, b, c, in[3] + K2, 5);
+  ROUND(G, c, d, a, b, in[5] + K2, 9);
+  ROUND(G, b, c, d, a, in[7] + K2, 13);
+  ROUND(G, a, b, c, d, in[0] + K2, 3);
+  ROUND(G, d, a, b, c, in[2] + K2, 5);
+  ROUND(G, c, d, a, b, in[4] + K2, 9);
+  ROUND(G, b, c, d, a, in[6] + K2, 13);
+
+  ROUND(H, a, b, c, d, in[3] + K3, 3);
+  ROUND(H, d, a, b, c, in[7] + K3, 9);
+  ROUND(H, c, d, a, b, in[2] + K3, 11);
+  ROUND(H, b, c, d, a, in[6] + K3, 15);
+  ROUND(H, a, b, c, d, in[1] + K3, 3);
+  ROUND(H, d, a, b, c, in[5] + K3, 9);
+  ROUND(H, c, d, a, b, in[0] + K3, 11);
+  ROUND(H, b, c, d, a, in[4] + K3, 15);
+
+  buf[0] += a;
+  buf[1] += b;
+  buf[2] += c;
+  buf[3] += d;
+}
+
+// 16 rounds of TEA.
+static void
+ext2fs_tea(uint buf[4], uint in[4])
+{
+  uint sum = 0, b0 = buf[0], b1 = buf[1];
+  uint a = in[0], b = in[1], c = in[2], d = in[3];
+  int n;
+
+  for (n = 0; n < 16; n++){
+    sum += 0x9E3779B9;
+    b0 += ((b1 << 4)+a) ^ (b1+sum) ^ ((b1 >> 5)+b);
+    b1 += ((b0 << 4)+c) ^ (b0+sum) ^ ((b0 >> 5)+d);
+  }
+  buf[0] += b0;
+  buf[1] += b1;
+}
+
+// Hash name with hash function version, the way Linux does,
+// so that both find names in the same leaves.
+static uint
+ext2fs_dirhash(const char *name, int len, int version)
+{
+  uint buf[4], in[8], hash;
+  int i, unsig;
+
+  buf[0] = 0x67452301;
+  buf[1] = 0xefcdab89;
+  buf[2] = 0x98badcfe;
+  buf[3] = 0x10325476;
+  for (i = 0; i < 4; i++){
+    if (ext2_sb.s_hash_seed[i]){
+      memmove(buf, ext2_sb.s_hash_seed, sizeof(buf));
+      break;
+    }
+  }
+
+  unsig = version >= EXT2_DX_HASH_UNSIGNED;
+  switch (unsig ? version - EXT2_DX_HASH_UNSIGNED : version){
+  case EXT2_DX_HASH_LEGACY:
+    hash = ext2fs_dx_hack_hash(name, len, unsig);
+    break;
+  case EXT2_DX_HASH_HALF_MD4:
+    for (; len > 0; len -= 32, name += 32){
+      ext2fs_str2hashbuf(name, len, in, 8, unsig);
+      ext2fs_half_md4(buf, in);
+    }
+    hash = buf[1];
+    break;
+  case EXT2_DX_HASH_TEA:
+    for (; len > 0; len -= 16, name += 16){
+      ext2fs_str2hashbuf(name, len, in, 4, unsig);
+      ext2fs_tea(buf, in);
+    }
+    hash = buf[0];
+    break;
+  default:
+    panic("ext2fs_dirhash");
+  }
+
+  // The low bit marks continued hashes in index blocks, and
+  // the top value means end of directory to readdir.
+  hash &= ~1;
+  if (hash == (0x7fffffff << 1))
+    hash = (0x7fffffff - 1) << 1;
+  return hash;
+}
+
+// Entries of index block bp, which is the root if lbn is 0.
+// Entry 0's hash is where the count and limit are kept.
+static struct ext2_dx_entry*
+ext2fs_dx_entries(struct buf *bp, uint lbn)
+{
+  return (struct ext2_dx_entry *)(bp->data +
+    (lbn == 0 ? EXT2_DX_ROOT_OFF : EXT2_DX_NODE_OFF));
+}
+
+#define DX_COUNT(e) (((struct ext2_dx_countlimit *)(e))->count)
+#define DX_LIMIT(e) (((struct ext2_dx_countlimit *)(e))->limit)
+#define DX_ROOT_LIMIT ((EXT2_BSIZE - EXT2_DX_ROOT_OFF) / sizeof(struct ext2_dx_entry))
+#define DX_NODE_LIMIT ((EXT2_BSIZE - EXT2_DX_NODE_OFF) / sizeof(struct ext2_dx_entry))
+
+static int
+ext2fs_is_dx(struct inode *dp)
+{
+  return (ext2_sb.s_feature_compat & EXT2_FEATURE_COMPAT_DIR_INDEX) &&
+         (((struct ext2fs_addrs *)dp->addrs)->flags & EXT2_INDEX_FL);
+}
+
+// Walk dp's index from the root to the leaf for name.
+// Returns -1 if the index is not one we understand.
+static int
+ext2fs_dx_probe(struct inode *dp, char *name, int len, struct dx_path *path)
+{
+  struct buf *bp;
+  struct ext2_dx_root_info *info;
+  struct ext2_dx_entry *e;
+  uint lbn, nblocks, count, limit;
+  int i, lo, hi, mid, levels;
+
+  nblocks = dp->size / EXT2_BSIZE;
+  bp = bread(dp->dev, ext2fs_bmap(dp, 0, 0));
+  info = (struct ext2_dx_root_info *)(bp->data + EXT2_DX_INFO_OFF);
+  path->version = info->hash_version;
+  levels = info->indirect_levels;
+  if (info->reserved_zero != 0 || info->info_length != 8 ||
+      path->version > EXT2_DX_HASH_TEA || levels >= EXT2_DX_MAXLEVELS ||
+      (info->unused_flags & 1)){
+    brelse(bp);
+    return -1;
+  }
+  brelse(bp);
+  if (ext2_sb.s_flags & EXT2_FLAGS_UNSIGNED_HASH)
+    path->version += EXT2_DX_HASH_UNSIGNED;
+  path->hash = ext2fs_dirhash(name, len, path->version);
+
+  lbn = 0;
+  for (i = 0; i <= levels; i++){
+    bp = bread(dp->dev, ext2fs_bmap(dp, lbn, 0));
+    e = ext2fs_dx_entries(bp, lbn);
+    count = DX_COUNT(e);
+    limit = DX_LIMIT(e);
+    if (limit != (lbn == 0 ? DX_ROOT_LIMIT : DX_NODE_LIMIT) ||
+        count == 0 || count > limit){
+      brelse(bp);
+      return -1;
+    }
+    // Find the last entry with a hash no greater than ours.
+    // Entry 0 has no hash; it covers everything below entry 1.
+    lo = 1;
+    hi = count - 1;
+    while (lo <= hi){
+      mid = (lo + hi) / 2;
+      if (e[mid].hash > path->hash)
+        hi = mid - 1;
+      else
+        lo = mid + 1;
+    }
+    path->frame[i].lbn = lbn;
+    path->frame[i].at = lo - 1;
+    lbn = e[lo - 1].block;
+    brelse(bp);
+    if (lbn == 0 || lbn >= nblocks)
+      return -1;
+  }
+  path->nframe = levels + 1;
+  path->leaf = lbn;
+  return 0;
+}
+
+// Move path to the next leaf, if that leaf may also hold
+// names with path's hash.  Returns 0 if it may not.
+static int
+ext2fs_dx_next(struct inode *dp, struct dx_path *path)
+{
+  struct buf *bp;
+  struct ext2_dx_entry *e;
+  struct dx_frame *f;
+  uint bhash, lbn;
+
+  // Step the deepest index block that is not at its end.
+  for (f = &path->frame[path->nframe - 1]; f >= path->frame; f--){
+    bp = bread(dp->dev, ext2fs_bmap(dp, f->lbn, 0));
+    e = ext2fs_dx_entries(bp, f->lbn);
+    if (f->at + 1 < DX_COUNT(e)){
+      f->at++;
+      bhash = e[f->at].hash;
+      lbn = e[f->at].block;
+      brelse(bp);
+      break;
+    }
+    brelse(bp);
+  }
+  if (f < path->frame)
+    return 0;
+
+  // Names with our hash spill into the next leaf only if the
+  // split that made it marked its hash as continued.
+  if ((bhash & ~1) != path->hash)
+    return 0;
+
+  // Go down the leftmost side of the new subtree.
+  for (f++; f < &path->frame[path->nframe]; f++){
+    if (lbn == 0 || lbn >= dp->size / EXT2_BSIZE)
+      return 0;
+    f->lbn = lbn;
+    f->at = 0;
+    bp = bread(dp->dev, ext2fs_bmap(dp, lbn, 0));
+    lbn = ext2fs_dx_entries(bp, lbn)[0].block;
+    brelse(bp);
+  }
+  if (lbn == 0 || lbn >= dp->size / EXT2_BSIZE)
+    return 0;
+  path->leaf = lbn;
+  return 1;
+}
+
+// Look for name in directory block lbn.  Returns its inode
+// number and sets *poff, or returns 0.
+static uint
+ext2fs_dirscan(struct inode *dp, uint lbn, char *name, uint len, uint *poff)
+{
+  uint boff, inum;
+  struct buf *bp;
+  struct ext2_dir_entry_2 *de;
+
+  bp = bread(dp->dev, ext2fs_bmap(dp, lbn, 0));
+  for (boff = 0; boff < EXT2_BSIZE; boff += de->rec_len){
+    de = DIRENT(bp, boff);
+    if (de->rec_len < EXT2_DIR_REC_LEN(1) || boff + de->rec_len > EXT2_BSIZE)
+      break;  // corrupt; skip the rest of the block
+    if (de->inode != 0 && de->name_len == len &&
+        memcmp(de->name, name, len) == 0){
+      inum = de->inode;
+      brelse(bp);
+      if (poff)
+        *poff = lbn * EXT2_BSIZE + boff;
+      return inum;
+    }
+  }
+  brelse(bp);
+  return 0;
+}
+
+// Look for a directory entry in a directory.
+// If found, set *poff to byte offset of entry.
+// Each directory block is read once, and its entries are
+// compared in place, by length first.  An indexed directory
+// is searched only in the leaves for the name's hash.
 struct inode*
 ext2fs_dirlookup(struct inode *dp, char *name, uint *poff)
 {
-  uint off;
-  struct ext2_dir_entry_2 de;
-  char file_name[EXT2_NAME_LEN + 1];
-  for (off = 0; off < dp->size; off += de.rec_len){
-    if (dp->iops->readi(dp, (char *)&de, off,sizeof(de)) != sizeof(de))
-      panic("ext2fs_dirlookup: read error");
-    if (de.inode == 0)
+  uint lbn, nblocks, len, inum;
+  struct dx_path path;
+
+  len = strlen(name);
+  nblocks = dp->size / EXT2_BSIZE;
+  if (name[0] == '.' && (len == 1 || (len == 2 && name[1] == '.')))
+    nblocks = min(nblocks, 1);  // always in the first block
+  else if (ext2fs_is_dx(dp) && ext2fs_dx_probe(dp, name, len, &path) == 0){
+    do {
+      if ((inum = ext2fs_dirscan(dp, path.leaf, name, len, poff)) != 0)
+        return iget(dp->dev, inum);
+    } while (ext2fs_dx_next(dp, &path));
+    return 0;
+  }
+
+  for (lbn = 0; lbn < nblocks; lbn++)
+    if ((inum = ext2fs_dirscan(dp, lbn, name, len, poff)) != 0)
+      return iget(dp->dev, inum);
+  return 0;
+}
+
+// Add an entry for name to directory block bp, in the first
+// unused entry or slack after an entry's name that is big
+// enough.  Returns 0 if it does not fit.
+static int
+ext2fs_dirent_add(struct buf *bp, char *name, uint len, uint inum, uchar type)
+{
+  struct ext2_dir_entry_2 *de, *nde;
+  uint off, used;
+
+  for (off = 0; off < EXT2_BSIZE; off += de->rec_len){
+    de = DIRENT(bp, off);
+    if (de->rec_len < EXT2_DIR_REC_LEN(1) || off + de->rec_len > EXT2_BSIZE)
+      return 0;  // corrupt
+    used = de->inode ? EXT2_DIR_REC_LEN(de->name_len) : 0;
+    if (de->rec_len >= used + EXT2_DIR_REC_LEN(len))
+      break;
+  }
+  if (off >= EXT2_BSIZE)
+    return 0;
+  if (used){
+    nde = DIRENT(bp, off + used);
+    nde->rec_len = de->rec_len - used;
+    de->rec_len = used;
+    de = nde;
+  }
+  de->inode = inum;
+  de->name_len = len;
+  de->file_type = type;
+  memmove(de->name, name, len);
+  return 1;
+}
+
+// Append an empty block to directory dp, and return it
+// locked.  The caller logs it.
+static struct buf*
+ext2fs_dir_newblock(struct inode *dp, uint *plbn)
+{
+  struct buf *bp;
+
+  *plbn = dp->size / EXT2_BSIZE;
+  bp = bgetblk(dp->dev, ext2fs_bmap(dp, *plbn, 0));
+  memset(bp->data, 0, EXT2_BSIZE);
+  DIRENT(bp, 0)->rec_len = EXT2_BSIZE;
+  dp->size += EXT2_BSIZE;
+  dp->iops->iupdate(dp);
+  return bp;
+}
+
+// Directory entry type of inode inum, if the file system
+// records types and inum is in the cache.  Devices are left
+// unknown: iupdate does not give them a device mode.
+static uchar
+ext2fs_filetype(uint dev, uint inum)
+{
+  if ((ext2_sb.s_feature_incompat & EXT2_FEATURE_INCOMPAT_FILETYPE) == 0)
+    return EXT2_FT_UNKNOWN;
+  switch (icachetype(dev, inum)){
+  case T_DIR:
+    return EXT2_FT_DIR;
+  case T_FILE:
+    return EXT2_FT_REG_FILE;
+  default:
+    return EXT2_FT_UNKNOWN;
+  }
+}
+
+// Give single-block directory dp an index.  Its entries
+// other than "." and ".." move to a new leaf, and block 0
+// becomes the root.  Returns -1 if dp does not start with
+// "." and "..".
+static int
+ext2fs_dx_make(struct inode *dp)
+{
+  struct buf *bp, *bp1;
+  struct ext2_dir_entry_2 *dot, *dotdot, *de, *last;
+  struct ext2_dx_root_info *info;
+  struct ext2_dx_entry *e;
+  uint off, noff, lbn, n;
+
+  bp = bread(dp->dev, ext2fs_bmap(dp, 0, 0));
+  dot = DIRENT(bp, 0);
+  dotdot = DIRENT(bp, EXT2_DIR_REC_LEN(1));
+  if (dot->rec_len != EXT2_DIR_REC_LEN(1) || dot->name_len != 1 ||
+      dot->name[0] != '.' || dotdot->name_len != 2 ||
+      memcmp(dotdot->name, "..", 2) != 0 ||
+      dotdot->rec_len < EXT2_DIR_REC_LEN(2) ||
+      EXT2_DIR_REC_LEN(1) + dotdot->rec_len > EXT2_BSIZE){
+    brelse(bp);
+    return -1;
+  }
+
+  bp1 = ext2fs_dir_newblock(dp, &lbn);
+  last = 0;
+  noff = 0;
+  for (off = EXT2_DIR_REC_LEN(1) + dotdot->rec_len; off < EXT2_BSIZE; off += de->rec_len){
+    de = DIRENT(bp, off);
+    if (de->rec_len < EXT2_DIR_REC_LEN(1))
+      panic("ext2fs_dx_make: bad rec_len");
+    if (de->inode == 0)
       continue;
-    strncpy(file_name, de.name, de.name_len);
-    file_name[de.name_len] = '\0';
-    if (ext2fs_namecmp(name, file_name) == 0){
-      if (poff)
-        *poff = off;
-      return iget(dp->dev, de.inode);
-    }
+    n = EXT2_DIR_REC_LEN(de->name_len);
+    last = DIRENT(bp1, noff);
+    memmove(last, de, n);
+    last->rec_len = n;
+    noff += n;
+  }
+  if (last)
+    last->rec_len += EXT2_BSIZE - noff;
+
+  dotdot->rec_len = EXT2_BSIZE - EXT2_DIR_REC_LEN(1);
+  memset(bp->data + EXT2_DX_INFO_OFF, 0, EXT2_BSIZE - EXT2_DX_INFO_OFF);
+  info = (struct ext2_dx_root_info *)(bp->data + EXT2_DX_INFO_OFF);
+  info->hash_version = ext2_sb.s_def_hash_version <= EXT2_DX_HASH_TEA ?
+    ext2_sb.s_def_hash_version : EXT2_DX_HASH_HALF_MD4;
+  info->info_length = 8;
+  e = ext2fs_dx_entries(bp, 0);
+  DX_LIMIT(e) = DX_ROOT_LIMIT;
+  DX_COUNT(e) = 1;
+  e[0].block = lbn;
+
+  log_write(bp1);
+  brelse(bp1);
+  log_write(bp);
+  brelse(bp);
+  ((struct ext2fs_addrs *)dp->addrs)->flags |= EXT2_INDEX_FL;
+  dp->iops->iupdate(dp);
+  return 0;
+}
+
+// Insert (hash, block) into index entries e at position at.
+static void
+ext2fs_dx_insert(struct ext2_dx_entry *e, int at, uint hash, uint block)
+{
+  memmove(e + at + 1, e + at, (DX_COUNT(e) - at) * sizeof(*e));
+  e[at].hash = hash;
+  e[at].block = block;
+  DX_COUNT(e)++;
+}
+
+// Make room for one more entry in the index block at the
+// bottom of path, adding a level or splitting it.  Returns
+// -1 if the directory cannot grow any further.
+static int
+ext2fs_dx_grow(struct inode *dp, struct dx_path *path)
+{
+  struct buf *bp, *rbp, *nbp;
+  struct ext2_dx_entry *e, *re, *ne;
+  struct dx_frame *f;
+  uint nlbn, hash;
+  int half;
+
+  f = &path->frame[path->nframe - 1];
+  bp = bread(dp->dev, ext2fs_bmap(dp, f->lbn, 0));
+  e = ext2fs_dx_entries(bp, f->lbn);
+  if (DX_COUNT(e) < DX_LIMIT(e)){
+    brelse(bp);
+    return 0;
+  }
+
+  if (path->nframe == 1){
+    // The root is full: move its entries down a level.
+    nbp = ext2fs_dir_newblock(dp, &nlbn);
+    ne = ext2fs_dx_entries(nbp, nlbn);
+    memmove(ne, e, DX_COUNT(e) * sizeof(*e));
+    DX_LIMIT(ne) = DX_NODE_LIMIT;
+    DX_COUNT(e) = 1;
+    e[0].block = nlbn;
+    ((struct ext2_dx_root_info *)(bp->data + EXT2_DX_INFO_OFF))->indirect_levels = 1;
+    path->frame[1].lbn = nlbn;
+    path->frame[1].at = path->frame[0].at;
+    path->frame[0].at = 0;
+    path->nframe = 2;
+    log_write(nbp);
+    brelse(nbp);
+    log_write(bp);
+    brelse(bp);
+    return 0;
+  }
+
+  // An index block below the root is full: split it, if the
+  // root has room for another.
+  rbp = bread(dp->dev, ext2fs_bmap(dp, 0, 0));
+  re = ext2fs_dx_entries(rbp, 0);
+  if (DX_COUNT(re) >= DX_LIMIT(re)){
+    brelse(rbp);
+    brelse(bp);
+    return -1;
+  }
+  nbp = ext2fs_dir_newblock(dp, &nlbn);
+  ne = ext2fs_dx_entries(nbp, nlbn);
+  half = DX_COUNT(e) / 2;
+  hash = e[half].hash;
+  memmove(ne, e + half, (DX_COUNT(e) - half) * sizeof(*e));
+  DX_LIMIT(ne) = DX_NODE_LIMIT;
+  DX_COUNT(ne) = DX_COUNT(e) - half;
+  DX_COUNT(e) = half;
+  ext2fs_dx_insert(re, path->frame[0].at + 1, hash, nlbn);
+  if (f->at >= half){
+    f->lbn = nlbn;
+    f->at -= half;
+    path->frame[0].at++;
+  }
+  log_write(nbp);
+  brelse(nbp);
+  log_write(rbp);
+  brelse(rbp);
+  log_write(bp);
+  brelse(bp);
+  return 0;
+}
+
+// Move the upper half by hash of the entries of leaf
+// path->leaf to a new leaf, and index it.  Then add name to
+// whichever leaf its hash belongs in.  The halves are split
+// by the space their entries take, not by how many there
+// are.  Returns -1, changing nothing, if the leaf cannot be
+// split so that name fits.
+static int
+ext2fs_dx_split(struct inode *dp, struct dx_path *path, char *name, uint len,
+                uint inum, uchar type)
+{
+  struct dx_map {
+    uint hash;
+    ushort off;
+    ushort size;
+  } *map, t;
+  uchar moved[EXT2_BSIZE / 4 / 8];
+  struct buf *bp, *nbp, *ibp;
+  struct ext2_dir_entry_2 *de, *last;
+  struct dx_frame *f;
+  uint off, noff, rec, nlbn, hash2, size, used;
+  int i, j, n, m, continued;
+
+  // A page holds a map entry for the most entries a block can.
+  if (sizeof(*map) * (EXT2_BSIZE / EXT2_DIR_REC_LEN(1)) > PGSIZE)
+    panic("ext2fs_dx_split: map");
+  if ((map = (struct dx_map *)kalloc()) == 0)
+    return -1;
+
+  bp = bread(dp->dev, ext2fs_bmap(dp, path->leaf, 0));
+  n = 0;
+  for (off = 0; off < EXT2_BSIZE; off += de->rec_len){
+    de = DIRENT(bp, off);
+    if (de->rec_len < EXT2_DIR_REC_LEN(1))
+      panic("ext2fs_dx_split: bad rec_len");
+    if (de->inode == 0)
+      continue;
+    map[n].hash = ext2fs_dirhash(de->name, de->name_len, path->version);
+    map[n].off = off;
+    map[n].size = EXT2_DIR_REC_LEN(de->name_len);
+    n++;
   }
+  for (i = 1; i < n; i++){
+    t = map[i];
+    for (j = i; j > 0 && map[j - 1].hash > t.hash; j--)
+      map[j] = map[j - 1];
+    map[j] = t;
+  }
+  if (n < 2){
+    kfree((char *)map);
+    brelse(bp);
+    return -1;
+  }
+
+  // Move entries from the top until the new leaf holds about
+  // half of the bytes, but leave at least one behind.
+  size = 0;
+  for (m = n; m > 1; m--){
+    if (size + map[m - 1].size / 2 > EXT2_BSIZE / 2)
+      break;
+    size += map[m - 1].size;
+  }
+  if (m == n)
+    m = n - 1;
+  hash2 = map[m].hash;
+  continued = hash2 == map[m - 1].hash;
+
+  // Make sure name fits in its half before changing anything.
+  used = 0;
+  for (i = 0; i < n; i++)
+    if ((i >= m) == (path->hash >= hash2))
+      used += map[i].size;
+  if (used + EXT2_DIR_REC_LEN(len) > EXT2_BSIZE){
+    kfree((char *)map);
+    brelse(bp);
+    return -1;
+  }
+
+  // Copy the upper half to the new leaf.
+  nbp = ext2fs_dir_newblock(dp, &nlbn);
+  memset(moved, 0, sizeof(moved));
+  last = 0;
+  noff = 0;
+  for (i = m; i < n; i++){
+    last = DIRENT(nbp, noff);
+    memmove(last, DIRENT(bp, map[i].off), map[i].size);
+    last->rec_len = map[i].size;
+    noff += map[i].size;
+    moved[map[i].off / 4 / 8] |= 1 << (map[i].off / 4 % 8);
+  }
+  last->rec_len += EXT2_BSIZE - noff;
+  kfree((char *)map);
+
+  // Pack what is left at the start of the old leaf.
+  last = 0;
+  noff = 0;
+  for (off = 0; off < EXT2_BSIZE; off += rec){
+    de = DIRENT(bp, off);
+    rec = de->rec_len;
+    if (de->inode == 0 || (moved[off / 4 / 8] & (1 << (off / 4 % 8))))
+      continue;
+    last = DIRENT(bp, noff);
+    memmove(last, de, EXT2_DIR_REC_LEN(de->name_len));
+    last->rec_len = EXT2_DIR_REC_LEN(last->name_len);
+    noff += last->rec_len;
+  }
+  last->rec_len += EXT2_BSIZE - noff;
+
+  // Index the new leaf.  If a hash is split between the two
+  // leaves, mark it continued, so lookups look at both.
+  f = &path->frame[path->nframe - 1];
+  ibp = bread(dp->dev, ext2fs_bmap(dp, f->lbn, 0));
+  ext2fs_dx_insert(ext2fs_dx_entries(ibp, f->lbn), f->at + 1,
+                   hash2 + continued, nlbn);
+  log_write(ibp);
+  brelse(ibp);
+
+  if (!ext2fs_dirent_add(path->hash >= hash2 ? nbp : bp, name, len, inum, type))
+    panic("ext2fs_dx_split: no room");
+  log_write(nbp);
+  brelse(nbp);
+  log_write(bp);
+  brelse(bp);
   return 0;
 }
 
+// Add name to indexed directory dp, in the leaf path leads
+// to, splitting it if it is full.
+static int
+ext2fs_dx_add(struct inode *dp, struct dx_path *path, char *name, uint len,
+              uint inum, uchar type)
+{
+  struct buf *bp;
+
+  bp = bread(dp->dev, ext2fs_bmap(dp, path->leaf, 0));
+  if (ext2fs_dirent_add(bp, name, len, inum, type)){
+    log_write(bp);
+    brelse(bp);
+    return 0;
+  }
+  brelse(bp);
+  if (ext2fs_dx_grow(dp, path) < 0)
+    return -1;
+  return ext2fs_dx_split(dp, path, name, len, inum, type);
+}
+
+// Remove the directory entry at byte offset off of dp, giving
+// its space to the entry before it in the block, for dirlink
+// to reuse.
+void
+ext2fs_dirunlink(struct inode *dp, uint off)
+{
+  struct buf *bp;
+  struct ext2_dir_entry_2 *de, *prev;
+  uint boff;
+
+  bp = bread(dp->dev, ext2fs_bmap(dp, off / EXT2_BSIZE, 0));
+  prev = 0;
+  for (boff = 0; boff < off % EXT2_BSIZE; boff += de->rec_len){
+    de = DIRENT(bp, boff);
+    if (de->rec_len < EXT2_DIR_REC_LEN(1))
+      panic("ext2fs_dirunlink: bad rec_len");
+    prev = de;
+  }
+  if (boff != off % EXT2_BSIZE)
+    panic("ext2fs_dirunlink: no entry");
+  de = DIRENT(bp, boff);
+  if (prev)
+    prev->rec_len += de->rec_len;
+  else
+    de->inode = 0;  // keep the block's first entry
+  log_write(bp);
+  brelse(bp);
+}
+
+// Is the directory dp empty except for "." and ".." ?
+// Follows each block's rec_len chain, so neither the names
+// left in the slack of merged entries nor an index root
+// hidden in ".." count.
+int
+ext2fs_dirempty(struct inode *dp)
+{
+  struct buf *bp;
+  struct ext2_dir_entry_2 *de;
+  uint lbn, off;
+  int empty;
+
+  empty = 1;
+  for (lbn = 0; empty && lbn < dp->size / EXT2_BSIZE; lbn++){
+    bp = bread(dp->dev, ext2fs_bmap(dp, lbn, 0));
+    for (off = 0; off < EXT2_BSIZE; off += de->rec_len){
+      de = DIRENT(bp, off);
+      if (de->rec_len < EXT2_DIR_REC_LEN(1) || off + de->rec_len > EXT2_BSIZE)
+        break;  // corrupt; skip the rest of the block
+      if (de->inode == 0)
+        continue;
+      if (de->name[0] == '.' && (de->name_len == 1 ||
+          (de->name_len == 2 && de->name[1] == '.')))
+        continue;
+      empty = 0;
+      break;
+    }
+    brelse(bp);
+  }
+  return empty;
+}
+
+// Write a new directory entry (name, inum) into the directory dp.
 int
 ext2fs_dirlink(struct inode *dp, char *name, uint inum)
 {
-  int off;
-  struct ext2_dir_entry_2 de;
   struct inode *ip;
+  struct buf *bp;
+  struct dx_path path;
+  uint lbn, nblocks, len;
+  uchar type;
 
   if((ip = dp->iops->dirlookup(dp, name, 0)) != 0){
     ip->iops->iput(ip);
     return -1;
   }
+  len = strlen(name);
+  type = ext2fs_filetype(dp->dev, inum);
+
+  if (ext2fs_is_dx(dp)){
+    if (ext2fs_dx_probe(dp, name, len, &path) == 0)
+      return ext2fs_dx_add(dp, &path, name, len, inum, type);
+    // Not an index we understand: use the directory as a
+    // plain one, as Linux does.
+    ((struct ext2fs_addrs *)dp->addrs)->flags &= ~EXT2_INDEX_FL;
+    dp->iops->iupdate(dp);
+  }
 
-  for (off = 0; off < dp->size; off += sizeof(de)){
-    if (dp->iops->readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
-      panic("ext2fs_dirlink read");
-    if (de.inode == 0)
-      break;
+  nblocks = dp->size / EXT2_BSIZE;
+  for (lbn = 0; lbn < nblocks; lbn++){
+    bp = bread(dp->dev, ext2fs_bmap(dp, lbn, 0));
+    if (ext2fs_dirent_add(bp, name, len, inum, type)){
+      log_write(bp);
+      brelse(bp);
+      return 0;
+    }
+    brelse(bp);
   }
 
-  strncpy(de.name, name, de.name_len);
-  de.inode = inum;
-  de.rec_len = EXT2_BSIZE;
-  de.name_len = strlen(name);
-  dp->size = off + de.rec_len;
-  dp->iops->iupdate(dp);
-  dp->iops->writei(dp, (char*)&de, off , de.rec_len);
+  // A directory outgrowing its first block gets an index.
+  if (nblocks == 1 &&
+      (ext2_sb.s_feature_compat & EXT2_FEATURE_COMPAT_DIR_INDEX) &&
+      ext2fs_dx_make(dp) == 0 && ext2fs_dx_probe(dp, name, len, &path) == 0)
+    return ext2fs_dx_add(dp, &path, name, len, inum, type);
 
+  bp = ext2fs_dir_newblock(dp, &lbn);
+  if (!ext2fs_dirent_add(bp, name, len, inum, type))
+    panic("ext2fs_dirlink");
+  log_write(bp);
+  brelse(bp);
   return 0;
 }
-
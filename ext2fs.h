@@ -6,6 +6,8 @@ extern struct icache icache;
 
 #define GET_GROUP_NO(inum, ext2_sb) 	((inum - 1) / ext2_sb.s_inodes_per_group)
 #define GET_INODE_INDEX(inum, ext2_sb) 	((inum - 1) % ext2_sb.s_inodes_per_group)
+#define GET_BLOCK_GROUP(b, ext2_sb) 	(((b) - ext2_sb.s_first_data_block) / ext2_sb.s_blocks_per_group)
+#define GET_BLOCK_INDEX(b, ext2_sb) 	(((b) - ext2_sb.s_first_data_block) % ext2_sb.s_blocks_per_group)
 
 /*
  * Constants relative to the data blocks
@@ -18,18 +20,20 @@ extern struct icache icache;
 
 // Block sizes
 #define EXT2_INDIRECT                   (EXT2_BSIZE / sizeof(uint))
-#define EXT2_DINDIRECT                  (EXT2_BSIZE / sizeof(uint))*EXT2_INDIRECT
-#define EXT2_TINDIRECT                  (EXT2_BSIZE / sizeof(uint))*EXT2_DINDIRECT
+#define EXT2_DINDIRECT                  ((EXT2_BSIZE / sizeof(uint))*EXT2_INDIRECT)
+#define EXT2_TINDIRECT                  ((EXT2_BSIZE / sizeof(uint))*EXT2_DINDIRECT)
 #define EXT2_MAXFILE                    (EXT2_NDIR_BLOCKS + EXT2_INDIRECT + EXT2_DINDIRECT + EXT2_TINDIRECT)
 
 // for directory entry
 #define EXT2_NAME_LEN 255
 
 struct ext2fs_addrs {
-  uint busy;
   uint addrs[EXT2_N_BLOCKS];
+  uint last_pbn;  // last block allocated to the file, for locality
+  uint prealloc_start;  // blocks reserved for the file's next writes
+  uint prealloc_count;
+  uint flags;     // i_flags
 };
-extern struct ext2fs_addrs ext2fs_addrs[NINODE];
 
 struct ext2_super_block {
 	uint	s_inodes_count;		/* Inodes count */
@@ -100,9 +104,44 @@ struct ext2_super_block {
 	ushort	s_reserved_word_pad;
 	uint	s_default_mount_opts;
 	uint	s_first_meta_bg; 	/* First metablock block group */
-	uint	s_reserved[190];	/* Padding to the end of the block */
+	uint	s_mkfs_time;		/* When the filesystem was created */
+	uint	s_jnl_blocks[17]; 	/* Backup of the journal inode */
+	uint	s_blocks_count_hi;	/* Blocks count, high 32 bits */
+	uint	s_r_blocks_count_hi;	/* Reserved blocks count, high 32 bits */
+	uint	s_free_blocks_hi; 	/* Free blocks count, high 32 bits */
+	ushort	s_min_extra_isize;	/* All inodes have at least # bytes */
+	ushort	s_want_extra_isize; 	/* New inodes should reserve # bytes */
+	uint	s_flags;		/* Miscellaneous flags */
+	uint	s_reserved[167];	/* Padding to the end of the block */
 };
 
+// Feature flags
+#define EXT2_FEATURE_COMPAT_DIR_PREALLOC	0x0001
+#define EXT3_FEATURE_COMPAT_HAS_JOURNAL		0x0004
+#define EXT2_FEATURE_COMPAT_DIR_INDEX		0x0020
+#define EXT2_FEATURE_INCOMPAT_FILETYPE		0x0002
+#define EXT3_FEATURE_INCOMPAT_RECOVER		0x0004	/* journal needs replay */
+
+// Blocks to preallocate if the superblock does not say
+#define EXT2_DEFAULT_PREALLOC_BLOCKS	8
+
+// Most data blocks filewrite hands one ext2 writei.  Data
+// blocks are not journaled, but each may need a bitmap block.
+#define EXT2_WRITEBLOCKS	32
+
+// Most journal blocks a write logs besides those bitmap
+// blocks: the inode, the superblock, two group descriptor
+// blocks, and up to four indirect blocks with theirs.
+#define EXT2_WRITEMETA		12
+
+// Most journal blocks an ext2 operation writes.  Adding a
+// name to a directory with an index may split a leaf and an
+// index block, and grow the directory by two blocks; a write
+// may log as much as the two above.
+#define EXT2_MAXOPBLOCKS	44
+_Static_assert(EXT2_WRITEMETA + EXT2_WRITEBLOCKS <= EXT2_MAXOPBLOCKS,
+               "EXT2_MAXOPBLOCKS too small for filewrite");
+
 struct ext2_group_desc
 {
 	uint	bg_block_bitmap;		/* Blocks bitmap block */
@@ -115,6 +154,11 @@ struct ext2_group_desc
 	uint	bg_reserved[3];
 };
 
+// Group descriptors per block, and the number of groups the
+// in-memory descriptor table can hold.
+#define EXT2_DESC_PER_BLOCK	(EXT2_BSIZE / sizeof(struct ext2_group_desc))
+#define EXT2_MAXGROUPS		64
+
 /*
  * Structure of an inode on the disk
  */
@@ -186,6 +230,52 @@ struct ext2_dir_entry_2 {
 	char	name[EXT2_NAME_LEN];	/* File name */
 };
 
+// Directory entry file types
+#define EXT2_FT_UNKNOWN		0
+#define EXT2_FT_REG_FILE	1
+#define EXT2_FT_DIR		2
+
+// Bytes an entry with a name of length len needs: the 8-byte
+// header and the name, rounded up to a multiple of 4.
+#define EXT2_DIR_REC_LEN(len)	(((len) + 8 + 3) & ~3)
+
+/*
+ * HTree directory index (dir_index).  The root is block 0 of
+ * the directory, inside the slack of its ".." entry.
+ */
+#define EXT2_INDEX_FL		0x00001000	/* i_flags: hash-indexed directory */
+#define EXT2_FLAGS_SIGNED_HASH	0x0001		/* s_flags */
+#define EXT2_FLAGS_UNSIGNED_HASH	0x0002
+
+#define EXT2_DX_HASH_LEGACY	0
+#define EXT2_DX_HASH_HALF_MD4	1
+#define EXT2_DX_HASH_TEA	2
+#define EXT2_DX_HASH_UNSIGNED	3	/* added for unsigned char hashing */
+
+#define EXT2_DX_INFO_OFF	24	/* dx_root_info, after "." and ".." */
+#define EXT2_DX_ROOT_OFF	32	/* entries in the root */
+#define EXT2_DX_NODE_OFF	8	/* entries in other index blocks */
+#define EXT2_DX_MAXLEVELS	2	/* root and one level below it */
+
+struct ext2_dx_root_info {
+	uint	reserved_zero;
+	uchar	hash_version;
+	uchar	info_length;		/* 8 */
+	uchar	indirect_levels;
+	uchar	unused_flags;
+};
+
+struct ext2_dx_entry {
+	uint	hash;
+	uint	block;			/* directory block, not disk block */
+};
+
+/* Overlays the hash of an index block's entry 0. */
+struct ext2_dx_countlimit {
+	ushort	limit;
+	ushort	count;
+};
+
 // file type
 #define S_IFMT  00170000
 #define S_IFSOCK 0140000
@@ -0,0 +1,2530 @@
+
+_ext2fstest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "htreetest passed\n");
+}
+
+int
+main(void)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 e4 f0             	and    $0xfffffff0,%esp
+  //createtest();
+  opentest();
+       6:	e8 35 00 00 00       	call   40 <opentest>
+  writetest();
+       b:	e8 10 01 00 00       	call   120 <writetest>
+  balloctest();
+      10:	e8 9b 01 00 00       	call   1b0 <balloctest>
+  synctest();
+      15:	e8 26 02 00 00       	call   240 <synctest>
+  dirlookuptest();
+      1a:	e8 21 04 00 00       	call   440 <dirlookuptest>
+  dirlinktest();
+      1f:	e8 7c 04 00 00       	call   4a0 <dirlinktest>
+  dirsynctest();
+      24:	e8 97 07 00 00       	call   7c0 <dirsynctest>
+  htreetest();
+      29:	e8 52 0a 00 00       	call   a80 <htreetest>
+  exit();
+      2e:	e8 b0 0f 00 00       	call   fe3 <exit>
+      33:	66 90                	xchg   %ax,%ax
+      35:	66 90                	xchg   %ax,%ax
+      37:	66 90                	xchg   %ax,%ax
+      39:	66 90                	xchg   %ax,%ax
+      3b:	66 90                	xchg   %ax,%ax
+      3d:	66 90                	xchg   %ax,%ax
+      3f:	90                   	nop
+
+00000040 <opentest>:
+{
+      40:	55                   	push   %ebp
+      41:	89 e5                	mov    %esp,%ebp
+      43:	83 ec 10             	sub    $0x10,%esp
+  fd = open("/mnt/file1", O_RDWR);
+      46:	6a 02                	push   $0x2
+      48:	68 68 14 00 00       	push   $0x1468
+      4d:	e8 d1 0f 00 00       	call   1023 <open>
+  if (fd < 0){
+      52:	83 c4 10             	add    $0x10,%esp
+      55:	85 c0                	test   %eax,%eax
+      57:	0f 88 82 00 00 00    	js     df <opentest+0x9f>
+  close(fd);
+      5d:	83 ec 0c             	sub    $0xc,%esp
+      60:	50                   	push   %eax
+      61:	e8 a5 0f 00 00       	call   100b <close>
+  printf(1, "open test1 passed\n");
+      66:	58                   	pop    %eax
+      67:	5a                   	pop    %edx
+      68:	68 8b 14 00 00       	push   $0x148b
+      6d:	6a 01                	push   $0x1
+      6f:	e8 cc 10 00 00       	call   1140 <printf>
+  fd = open("/mnt/file2", O_RDWR);
+      74:	59                   	pop    %ecx
+      75:	58                   	pop    %eax
+      76:	6a 02                	push   $0x2
+      78:	68 9e 14 00 00       	push   $0x149e
+      7d:	e8 a1 0f 00 00       	call   1023 <open>
+  if (fd < 0){
+      82:	83 c4 10             	add    $0x10,%esp
+      85:	85 c0                	test   %eax,%eax
+      87:	78 7c                	js     105 <opentest+0xc5>
+  close(fd);
+      89:	83 ec 0c             	sub    $0xc,%esp
+      8c:	50                   	push   %eax
+      8d:	e8 79 0f 00 00       	call   100b <close>
+  printf(1, "open test2 passed\n");
+      92:	58                   	pop    %eax
+      93:	5a                   	pop    %edx
+      94:	68 c1 14 00 00       	push   $0x14c1
+      99:	6a 01                	push   $0x1
+      9b:	e8 a0 10 00 00       	call   1140 <printf>
+  fd = open("/mnt/file3", O_RDWR);
+      a0:	59                   	pop    %ecx
+      a1:	58                   	pop    %eax
+      a2:	6a 02                	push   $0x2
+      a4:	68 d4 14 00 00       	push   $0x14d4
+      a9:	e8 75 0f 00 00       	call   1023 <open>
+  if (fd < 0){
+      ae:	83 c4 10             	add    $0x10,%esp
+      b1:	85 c0                	test   %eax,%eax
+      b3:	78 3d                	js     f2 <opentest+0xb2>
+  close(fd);
+      b5:	83 ec 0c             	sub    $0xc,%esp
+      b8:	50                   	push   %eax
+      b9:	e8 4d 0f 00 00       	call   100b <close>
+  printf(1, "open test3 passed\n");
+      be:	58                   	pop    %eax
+      bf:	5a                   	pop    %edx
+      c0:	68 f7 14 00 00       	push   $0x14f7
+      c5:	6a 01                	push   $0x1
+      c7:	e8 74 10 00 00       	call   1140 <printf>
+  printf(1, "All open test passed succesfully\n");
+      cc:	59                   	pop    %ecx
+      cd:	58                   	pop    %eax
+      ce:	68 38 18 00 00       	push   $0x1838
+      d3:	6a 01                	push   $0x1
+      d5:	e8 66 10 00 00       	call   1140 <printf>
+}
+      da:	83 c4 10             	add    $0x10,%esp
+      dd:	c9                   	leave
+      de:	c3                   	ret
+    printf(1, "cannot open /mnt/file1\n");
+      df:	50                   	push   %eax
+      e0:	50                   	push   %eax
+      e1:	68 73 14 00 00       	push   $0x1473
+      e6:	6a 01                	push   $0x1
+      e8:	e8 53 10 00 00       	call   1140 <printf>
+    exit();
+      ed:	e8 f1 0e 00 00       	call   fe3 <exit>
+    printf(1, "cannot open /mnt/file3\n");
+      f2:	50                   	push   %eax
+      f3:	50                   	push   %eax
+      f4:	68 df 14 00 00       	push   $0x14df
+      f9:	6a 01                	push   $0x1
+      fb:	e8 40 10 00 00       	call   1140 <printf>
+    exit();
+     100:	e8 de 0e 00 00       	call   fe3 <exit>
+    printf(1, "cannot open /mnt/file2\n");
+     105:	50                   	push   %eax
+     106:	50                   	push   %eax
+     107:	68 a9 14 00 00       	push   $0x14a9
+     10c:	6a 01                	push   $0x1
+     10e:	e8 2d 10 00 00       	call   1140 <printf>
+    exit();
+     113:	e8 cb 0e 00 00       	call   fe3 <exit>
+     118:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     11f:	90                   	nop
+
+00000120 <writetest>:
+{
+     120:	55                   	push   %ebp
+     121:	89 e5                	mov    %esp,%ebp
+     123:	56                   	push   %esi
+     124:	53                   	push   %ebx
+  printf(1,"ext2 writetest\n");
+     125:	83 ec 08             	sub    $0x8,%esp
+     128:	68 0a 15 00 00       	push   $0x150a
+     12d:	6a 01                	push   $0x1
+     12f:	e8 0c 10 00 00       	call   1140 <printf>
+  fd = open("/mnt/file1", O_CREATE|O_RDWR);
+     134:	5b                   	pop    %ebx
+     135:	5e                   	pop    %esi
+     136:	68 02 02 00 00       	push   $0x202
+     13b:	68 68 14 00 00       	push   $0x1468
+     140:	e8 de 0e 00 00       	call   1023 <open>
+  if (fd < 0){
+     145:	83 c4 10             	add    $0x10,%esp
+     148:	85 c0                	test   %eax,%eax
+     14a:	78 45                	js     191 <writetest+0x71>
+     14c:	89 c6                	mov    %eax,%esi
+     14e:	bb 64 00 00 00       	mov    $0x64,%ebx
+     153:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     157:	90                   	nop
+    write(fd, "aaaaaaaaaa", 10);
+     158:	83 ec 04             	sub    $0x4,%esp
+     15b:	6a 0a                	push   $0xa
+     15d:	68 30 15 00 00       	push   $0x1530
+     162:	56                   	push   %esi
+     163:	e8 9b 0e 00 00       	call   1003 <write>
+  for (i = 0; i < 100; i++){
+     168:	83 c4 10             	add    $0x10,%esp
+     16b:	83 eb 01             	sub    $0x1,%ebx
+     16e:	75 e8                	jne    158 <writetest+0x38>
+  close(fd);
+     170:	83 ec 0c             	sub    $0xc,%esp
+     173:	56                   	push   %esi
+     174:	e8 92 0e 00 00       	call   100b <close>
+  printf(1,"Write test passed\n");
+     179:	58                   	pop    %eax
+     17a:	5a                   	pop    %edx
+     17b:	68 3b 15 00 00       	push   $0x153b
+     180:	6a 01                	push   $0x1
+     182:	e8 b9 0f 00 00       	call   1140 <printf>
+}
+     187:	83 c4 10             	add    $0x10,%esp
+     18a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     18d:	5b                   	pop    %ebx
+     18e:	5e                   	pop    %esi
+     18f:	5d                   	pop    %ebp
+     190:	c3                   	ret
+    printf(1,"Open in ext2 failed!\n");
+     191:	51                   	push   %ecx
+     192:	51                   	push   %ecx
+     193:	68 1a 15 00 00       	push   $0x151a
+     198:	6a 01                	push   $0x1
+     19a:	e8 a1 0f 00 00       	call   1140 <printf>
+    exit();
+     19f:	e8 3f 0e 00 00       	call   fe3 <exit>
+     1a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     1af:	90                   	nop
+
+000001b0 <balloctest>:
+{
+     1b0:	55                   	push   %ebp
+     1b1:	89 e5                	mov    %esp,%ebp
+     1b3:	56                   	push   %esi
+     1b4:	53                   	push   %ebx
+  printf(1,"ext2 balloc test\n");
+     1b5:	83 ec 08             	sub    $0x8,%esp
+     1b8:	68 4e 15 00 00       	push   $0x154e
+     1bd:	6a 01                	push   $0x1
+     1bf:	e8 7c 0f 00 00       	call   1140 <printf>
+  fd = open("/mnt/file3", O_CREATE|O_RDWR);
+     1c4:	5b                   	pop    %ebx
+     1c5:	5e                   	pop    %esi
+     1c6:	68 02 02 00 00       	push   $0x202
+     1cb:	68 d4 14 00 00       	push   $0x14d4
+     1d0:	e8 4e 0e 00 00       	call   1023 <open>
+  if (fd < 0){
+     1d5:	83 c4 10             	add    $0x10,%esp
+     1d8:	85 c0                	test   %eax,%eax
+     1da:	78 45                	js     221 <balloctest+0x71>
+     1dc:	89 c6                	mov    %eax,%esi
+     1de:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+     1e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     1e7:	90                   	nop
+    write(fd, "aaaaaaaaaa", 10);
+     1e8:	83 ec 04             	sub    $0x4,%esp
+     1eb:	6a 0a                	push   $0xa
+     1ed:	68 30 15 00 00       	push   $0x1530
+     1f2:	56                   	push   %esi
+     1f3:	e8 0b 0e 00 00       	call   1003 <write>
+  for (i=0; i < 1000; i++){
+     1f8:	83 c4 10             	add    $0x10,%esp
+     1fb:	83 eb 01             	sub    $0x1,%ebx
+     1fe:	75 e8                	jne    1e8 <balloctest+0x38>
+  close(fd);
+     200:	83 ec 0c             	sub    $0xc,%esp
+     203:	56                   	push   %esi
+     204:	e8 02 0e 00 00       	call   100b <close>
+  printf(1, "balloc test passed\n");
+     209:	58                   	pop    %eax
+     20a:	5a                   	pop    %edx
+     20b:	68 75 15 00 00       	push   $0x1575
+     210:	6a 01                	push   $0x1
+     212:	e8 29 0f 00 00       	call   1140 <printf>
+}
+     217:	83 c4 10             	add    $0x10,%esp
+     21a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     21d:	5b                   	pop    %ebx
+     21e:	5e                   	pop    %esi
+     21f:	5d                   	pop    %ebp
+     220:	c3                   	ret
+    printf(1, "open in ext2 failed\n");
+     221:	51                   	push   %ecx
+     222:	51                   	push   %ecx
+     223:	68 60 15 00 00       	push   $0x1560
+     228:	6a 01                	push   $0x1
+     22a:	e8 11 0f 00 00       	call   1140 <printf>
+    exit();
+     22f:	e8 af 0d 00 00       	call   fe3 <exit>
+     234:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     23b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     23f:	90                   	nop
+
+00000240 <synctest>:
+{
+     240:	55                   	push   %ebp
+     241:	89 e5                	mov    %esp,%ebp
+     243:	57                   	push   %edi
+     244:	56                   	push   %esi
+     245:	53                   	push   %ebx
+     246:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "ext2 sync test\n");
+     249:	68 89 15 00 00       	push   $0x1589
+     24e:	6a 01                	push   $0x1
+     250:	e8 eb 0e 00 00       	call   1140 <printf>
+  fd = open("/mnt/file2", O_CREATE|O_RDWR);
+     255:	5e                   	pop    %esi
+     256:	5f                   	pop    %edi
+     257:	68 02 02 00 00       	push   $0x202
+     25c:	68 9e 14 00 00       	push   $0x149e
+     261:	e8 bd 0d 00 00       	call   1023 <open>
+  if (fd < 0){
+     266:	83 c4 10             	add    $0x10,%esp
+     269:	85 c0                	test   %eax,%eax
+     26b:	0f 88 62 01 00 00    	js     3d3 <synctest+0x193>
+     271:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < 100; i++){
+     273:	31 ff                	xor    %edi,%edi
+     275:	8d 5d de             	lea    -0x22(%ebp),%ebx
+     278:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     27f:	90                   	nop
+    memset(chunk, 'a' + i % 26, sizeof(chunk));
+     280:	b8 4f ec c4 4e       	mov    $0x4ec4ec4f,%eax
+     285:	83 ec 04             	sub    $0x4,%esp
+     288:	f7 e7                	mul    %edi
+     28a:	89 f8                	mov    %edi,%eax
+     28c:	6a 0a                	push   $0xa
+     28e:	c1 ea 03             	shr    $0x3,%edx
+     291:	6b d2 1a             	imul   $0x1a,%edx,%edx
+     294:	29 d0                	sub    %edx,%eax
+     296:	83 c0 61             	add    $0x61,%eax
+     299:	50                   	push   %eax
+     29a:	53                   	push   %ebx
+     29b:	e8 c0 0b 00 00       	call   e60 <memset>
+    if (write(fd, chunk, sizeof(chunk)) != sizeof(chunk)){
+     2a0:	83 c4 0c             	add    $0xc,%esp
+     2a3:	6a 0a                	push   $0xa
+     2a5:	53                   	push   %ebx
+     2a6:	56                   	push   %esi
+     2a7:	e8 57 0d 00 00       	call   1003 <write>
+     2ac:	83 c4 10             	add    $0x10,%esp
+     2af:	83 f8 0a             	cmp    $0xa,%eax
+     2b2:	0f 85 f4 00 00 00    	jne    3ac <synctest+0x16c>
+  for (i = 0; i < 100; i++){
+     2b8:	83 c7 01             	add    $0x1,%edi
+     2bb:	83 ff 64             	cmp    $0x64,%edi
+     2be:	75 c0                	jne    280 <synctest+0x40>
+  if (fsync(fd) < 0){
+     2c0:	83 ec 0c             	sub    $0xc,%esp
+     2c3:	56                   	push   %esi
+     2c4:	e8 c2 0d 00 00       	call   108b <fsync>
+     2c9:	83 c4 10             	add    $0x10,%esp
+     2cc:	85 c0                	test   %eax,%eax
+     2ce:	0f 88 25 01 00 00    	js     3f9 <synctest+0x1b9>
+  close(fd);
+     2d4:	83 ec 0c             	sub    $0xc,%esp
+     2d7:	56                   	push   %esi
+     2d8:	e8 2e 0d 00 00       	call   100b <close>
+  if (sync() < 0){
+     2dd:	e8 a1 0d 00 00       	call   1083 <sync>
+     2e2:	83 c4 10             	add    $0x10,%esp
+     2e5:	85 c0                	test   %eax,%eax
+     2e7:	0f 88 f9 00 00 00    	js     3e6 <synctest+0x1a6>
+  fd = open("/mnt/file2", O_RDONLY);
+     2ed:	83 ec 08             	sub    $0x8,%esp
+     2f0:	6a 00                	push   $0x0
+     2f2:	68 9e 14 00 00       	push   $0x149e
+     2f7:	e8 27 0d 00 00       	call   1023 <open>
+  if (fd < 0 || read(fd, buf, 1000) != 1000){
+     2fc:	83 c4 10             	add    $0x10,%esp
+  fd = open("/mnt/file2", O_RDONLY);
+     2ff:	89 c3                	mov    %eax,%ebx
+  if (fd < 0 || read(fd, buf, 1000) != 1000){
+     301:	85 c0                	test   %eax,%eax
+     303:	0f 88 b7 00 00 00    	js     3c0 <synctest+0x180>
+     309:	83 ec 04             	sub    $0x4,%esp
+     30c:	68 e8 03 00 00       	push   $0x3e8
+     311:	68 60 1d 00 00       	push   $0x1d60
+     316:	50                   	push   %eax
+     317:	e8 df 0c 00 00       	call   ffb <read>
+     31c:	83 c4 10             	add    $0x10,%esp
+     31f:	3d e8 03 00 00       	cmp    $0x3e8,%eax
+     324:	0f 85 96 00 00 00    	jne    3c0 <synctest+0x180>
+  close(fd);
+     32a:	83 ec 0c             	sub    $0xc,%esp
+      if (buf[i * 10 + j] != 'a' + i % 26){
+     32d:	be 4f ec c4 4e       	mov    $0x4ec4ec4f,%esi
+  close(fd);
+     332:	53                   	push   %ebx
+  for (i = 0; i < 100; i++){
+     333:	31 db                	xor    %ebx,%ebx
+  close(fd);
+     335:	e8 d1 0c 00 00       	call   100b <close>
+     33a:	83 c4 10             	add    $0x10,%esp
+     33d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     342:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if (buf[i * 10 + j] != 'a' + i % 26){
+     348:	89 d8                	mov    %ebx,%eax
+     34a:	89 df                	mov    %ebx,%edi
+     34c:	f7 e6                	mul    %esi
+     34e:	8d 41 f6             	lea    -0xa(%ecx),%eax
+     351:	c1 ea 03             	shr    $0x3,%edx
+     354:	6b d2 1a             	imul   $0x1a,%edx,%edx
+     357:	29 d7                	sub    %edx,%edi
+     359:	83 c7 61             	add    $0x61,%edi
+     35c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     360:	0f be 90 60 1d 00 00 	movsbl 0x1d60(%eax),%edx
+     367:	39 fa                	cmp    %edi,%edx
+     369:	75 2c                	jne    397 <synctest+0x157>
+    for (j = 0; j < 10; j++){
+     36b:	83 c0 01             	add    $0x1,%eax
+     36e:	39 c8                	cmp    %ecx,%eax
+     370:	75 ee                	jne    360 <synctest+0x120>
+  for (i = 0; i < 100; i++){
+     372:	83 c3 01             	add    $0x1,%ebx
+     375:	8d 48 0a             	lea    0xa(%eax),%ecx
+     378:	83 fb 64             	cmp    $0x64,%ebx
+     37b:	75 cb                	jne    348 <synctest+0x108>
+  printf(1, "sync test passed\n");
+     37d:	83 ec 08             	sub    $0x8,%esp
+     380:	68 e4 15 00 00       	push   $0x15e4
+     385:	6a 01                	push   $0x1
+     387:	e8 b4 0d 00 00       	call   1140 <printf>
+}
+     38c:	83 c4 10             	add    $0x10,%esp
+     38f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     392:	5b                   	pop    %ebx
+     393:	5e                   	pop    %esi
+     394:	5f                   	pop    %edi
+     395:	5d                   	pop    %ebp
+     396:	c3                   	ret
+        printf(1, "wrong data at %d after sync\n", i * 10 + j);
+     397:	83 ec 04             	sub    $0x4,%esp
+     39a:	50                   	push   %eax
+     39b:	68 c7 15 00 00       	push   $0x15c7
+     3a0:	6a 01                	push   $0x1
+     3a2:	e8 99 0d 00 00       	call   1140 <printf>
+        exit();
+     3a7:	e8 37 0c 00 00       	call   fe3 <exit>
+      printf(1, "write failed\n");
+     3ac:	83 ec 08             	sub    $0x8,%esp
+     3af:	68 99 15 00 00       	push   $0x1599
+     3b4:	6a 01                	push   $0x1
+     3b6:	e8 85 0d 00 00       	call   1140 <printf>
+      exit();
+     3bb:	e8 23 0c 00 00       	call   fe3 <exit>
+    printf(1, "read back failed\n");
+     3c0:	50                   	push   %eax
+     3c1:	50                   	push   %eax
+     3c2:	68 b5 15 00 00       	push   $0x15b5
+     3c7:	6a 01                	push   $0x1
+     3c9:	e8 72 0d 00 00       	call   1140 <printf>
+    exit();
+     3ce:	e8 10 0c 00 00       	call   fe3 <exit>
+    printf(1, "open in ext2 failed\n");
+     3d3:	53                   	push   %ebx
+     3d4:	53                   	push   %ebx
+     3d5:	68 60 15 00 00       	push   $0x1560
+     3da:	6a 01                	push   $0x1
+     3dc:	e8 5f 0d 00 00       	call   1140 <printf>
+    exit();
+     3e1:	e8 fd 0b 00 00       	call   fe3 <exit>
+    printf(1, "sync failed\n");
+     3e6:	52                   	push   %edx
+     3e7:	52                   	push   %edx
+     3e8:	68 a8 15 00 00       	push   $0x15a8
+     3ed:	6a 01                	push   $0x1
+     3ef:	e8 4c 0d 00 00       	call   1140 <printf>
+    exit();
+     3f4:	e8 ea 0b 00 00       	call   fe3 <exit>
+    printf(1, "fsync failed\n");
+     3f9:	51                   	push   %ecx
+     3fa:	51                   	push   %ecx
+     3fb:	68 a7 15 00 00       	push   $0x15a7
+     400:	6a 01                	push   $0x1
+     402:	e8 39 0d 00 00       	call   1140 <printf>
+    exit();
+     407:	e8 d7 0b 00 00       	call   fe3 <exit>
+     40c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000410 <createtest>:
+{
+     410:	55                   	push   %ebp
+     411:	89 e5                	mov    %esp,%ebp
+     413:	83 ec 10             	sub    $0x10,%esp
+  fd = open("/mnt/new", O_CREATE);
+     416:	68 00 02 00 00       	push   $0x200
+     41b:	68 f6 15 00 00       	push   $0x15f6
+     420:	e8 fe 0b 00 00       	call   1023 <open>
+  close(fd);
+     425:	89 04 24             	mov    %eax,(%esp)
+     428:	e8 de 0b 00 00       	call   100b <close>
+}
+     42d:	83 c4 10             	add    $0x10,%esp
+     430:	c9                   	leave
+     431:	c3                   	ret
+     432:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     439:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000440 <dirlookuptest>:
+{
+     440:	55                   	push   %ebp
+     441:	89 e5                	mov    %esp,%ebp
+     443:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "ext2 dirlookup test\n");
+     446:	68 ff 15 00 00       	push   $0x15ff
+     44b:	6a 01                	push   $0x1
+     44d:	e8 ee 0c 00 00       	call   1140 <printf>
+  fd = open("/mnt/dir1/dir2/dir3/file", O_RDWR);
+     452:	58                   	pop    %eax
+     453:	5a                   	pop    %edx
+     454:	6a 02                	push   $0x2
+     456:	68 14 16 00 00       	push   $0x1614
+     45b:	e8 c3 0b 00 00       	call   1023 <open>
+  if (fd < 0){
+     460:	83 c4 10             	add    $0x10,%esp
+     463:	85 c0                	test   %eax,%eax
+     465:	78 1c                	js     483 <dirlookuptest+0x43>
+  close(fd);
+     467:	83 ec 0c             	sub    $0xc,%esp
+     46a:	50                   	push   %eax
+     46b:	e8 9b 0b 00 00       	call   100b <close>
+  printf(1, "dirlookuptest passed\n");
+     470:	58                   	pop    %eax
+     471:	5a                   	pop    %edx
+     472:	68 41 16 00 00       	push   $0x1641
+     477:	6a 01                	push   $0x1
+     479:	e8 c2 0c 00 00       	call   1140 <printf>
+}
+     47e:	83 c4 10             	add    $0x10,%esp
+     481:	c9                   	leave
+     482:	c3                   	ret
+    printf(1, "open in ext2 failed");
+     483:	51                   	push   %ecx
+     484:	51                   	push   %ecx
+     485:	68 2d 16 00 00       	push   $0x162d
+     48a:	6a 01                	push   $0x1
+     48c:	e8 af 0c 00 00       	call   1140 <printf>
+    exit();
+     491:	e8 4d 0b 00 00       	call   fe3 <exit>
+     496:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     49d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004a0 <dirlinktest>:
+{
+     4a0:	55                   	push   %ebp
+     4a1:	89 e5                	mov    %esp,%ebp
+     4a3:	57                   	push   %edi
+     4a4:	56                   	push   %esi
+     4a5:	53                   	push   %ebx
+     4a6:	83 ec 64             	sub    $0x64,%esp
+  printf(1, "ext2 dirlink test\n");
+     4a9:	68 57 16 00 00       	push   $0x1657
+     4ae:	6a 01                	push   $0x1
+     4b0:	e8 8b 0c 00 00       	call   1140 <printf>
+  if (mkdir("/mnt/dlt") < 0){
+     4b5:	c7 04 24 6a 16 00 00 	movl   $0x166a,(%esp)
+     4bc:	e8 8a 0b 00 00       	call   104b <mkdir>
+     4c1:	83 c4 10             	add    $0x10,%esp
+     4c4:	85 c0                	test   %eax,%eax
+     4c6:	0f 88 c9 02 00 00    	js     795 <dirlinktest+0x2f5>
+  strcpy(name, "/mnt/dlt/f00");
+     4cc:	83 ec 08             	sub    $0x8,%esp
+     4cf:	8d 5d c8             	lea    -0x38(%ebp),%ebx
+  for (i = 0; i < 100; i++){
+     4d2:	31 ff                	xor    %edi,%edi
+    name[10] = '0' + i / 10;
+     4d4:	be cd cc cc cc       	mov    $0xcccccccd,%esi
+  strcpy(name, "/mnt/dlt/f00");
+     4d9:	68 89 16 00 00       	push   $0x1689
+     4de:	53                   	push   %ebx
+     4df:	e8 bc 08 00 00       	call   da0 <strcpy>
+     4e4:	83 c4 10             	add    $0x10,%esp
+     4e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4ee:	66 90                	xchg   %ax,%ax
+    name[10] = '0' + i / 10;
+     4f0:	89 f8                	mov    %edi,%eax
+    if ((fd = open(name, O_CREATE|O_RDWR)) < 0){
+     4f2:	83 ec 08             	sub    $0x8,%esp
+    name[10] = '0' + i / 10;
+     4f5:	f7 e6                	mul    %esi
+     4f7:	c1 ea 03             	shr    $0x3,%edx
+     4fa:	8d 42 30             	lea    0x30(%edx),%eax
+    name[11] = '0' + i % 10;
+     4fd:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    name[10] = '0' + i / 10;
+     500:	88 45 d2             	mov    %al,-0x2e(%ebp)
+    name[11] = '0' + i % 10;
+     503:	01 d2                	add    %edx,%edx
+     505:	89 f8                	mov    %edi,%eax
+     507:	29 d0                	sub    %edx,%eax
+     509:	83 c0 30             	add    $0x30,%eax
+     50c:	88 45 d3             	mov    %al,-0x2d(%ebp)
+    if ((fd = open(name, O_CREATE|O_RDWR)) < 0){
+     50f:	68 02 02 00 00       	push   $0x202
+     514:	53                   	push   %ebx
+     515:	e8 09 0b 00 00       	call   1023 <open>
+     51a:	83 c4 10             	add    $0x10,%esp
+     51d:	85 c0                	test   %eax,%eax
+     51f:	0f 88 f4 01 00 00    	js     719 <dirlinktest+0x279>
+    close(fd);
+     525:	83 ec 0c             	sub    $0xc,%esp
+  for (i = 0; i < 100; i++){
+     528:	83 c7 01             	add    $0x1,%edi
+    close(fd);
+     52b:	50                   	push   %eax
+     52c:	e8 da 0a 00 00       	call   100b <close>
+  for (i = 0; i < 100; i++){
+     531:	83 c4 10             	add    $0x10,%esp
+     534:	83 ff 64             	cmp    $0x64,%edi
+     537:	75 b7                	jne    4f0 <dirlinktest+0x50>
+  if (stat("/mnt/dlt", &st) < 0 || st.size > 4 * 1024){
+     539:	83 ec 08             	sub    $0x8,%esp
+     53c:	8d 45 b4             	lea    -0x4c(%ebp),%eax
+     53f:	50                   	push   %eax
+     540:	68 6a 16 00 00       	push   $0x166a
+     545:	e8 d6 09 00 00       	call   f20 <stat>
+     54a:	83 c4 10             	add    $0x10,%esp
+     54d:	85 c0                	test   %eax,%eax
+     54f:	0f 88 53 02 00 00    	js     7a8 <dirlinktest+0x308>
+     555:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     558:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+     55b:	3d 00 10 00 00       	cmp    $0x1000,%eax
+     560:	0f 87 42 02 00 00    	ja     7a8 <dirlinktest+0x308>
+  for (i = 0; i < 100; i += 2){
+     566:	31 ff                	xor    %edi,%edi
+    name[10] = '0' + i / 10;
+     568:	be cd cc cc cc       	mov    $0xcccccccd,%esi
+     56d:	8d 76 00             	lea    0x0(%esi),%esi
+     570:	89 f8                	mov    %edi,%eax
+    if (unlink(name) < 0){
+     572:	83 ec 0c             	sub    $0xc,%esp
+    name[10] = '0' + i / 10;
+     575:	f7 e6                	mul    %esi
+     577:	c1 ea 03             	shr    $0x3,%edx
+     57a:	8d 42 30             	lea    0x30(%edx),%eax
+    name[11] = '0' + i % 10;
+     57d:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    name[10] = '0' + i / 10;
+     580:	88 45 d2             	mov    %al,-0x2e(%ebp)
+    name[11] = '0' + i % 10;
+     583:	01 d2                	add    %edx,%edx
+     585:	89 f8                	mov    %edi,%eax
+     587:	29 d0                	sub    %edx,%eax
+     589:	83 c0 30             	add    $0x30,%eax
+     58c:	88 45 d3             	mov    %al,-0x2d(%ebp)
+    if (unlink(name) < 0){
+     58f:	53                   	push   %ebx
+     590:	e8 9e 0a 00 00       	call   1033 <unlink>
+     595:	83 c4 10             	add    $0x10,%esp
+     598:	85 c0                	test   %eax,%eax
+     59a:	0f 88 8e 01 00 00    	js     72e <dirlinktest+0x28e>
+  for (i = 0; i < 100; i += 2){
+     5a0:	83 c7 02             	add    $0x2,%edi
+     5a3:	83 ff 64             	cmp    $0x64,%edi
+     5a6:	75 c8                	jne    570 <dirlinktest+0xd0>
+  name[9] = 'g';
+     5a8:	c6 45 d1 67          	movb   $0x67,-0x2f(%ebp)
+  for (i = 0; i < 100; i += 2){
+     5ac:	31 ff                	xor    %edi,%edi
+    name[10] = '0' + i / 10;
+     5ae:	be cd cc cc cc       	mov    $0xcccccccd,%esi
+     5b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     5b7:	90                   	nop
+     5b8:	89 f8                	mov    %edi,%eax
+    if ((fd = open(name, O_CREATE|O_RDWR)) < 0){
+     5ba:	83 ec 08             	sub    $0x8,%esp
+    name[10] = '0' + i / 10;
+     5bd:	f7 e6                	mul    %esi
+     5bf:	c1 ea 03             	shr    $0x3,%edx
+     5c2:	8d 42 30             	lea    0x30(%edx),%eax
+    name[11] = '0' + i % 10;
+     5c5:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    name[10] = '0' + i / 10;
+     5c8:	88 45 d2             	mov    %al,-0x2e(%ebp)
+    name[11] = '0' + i % 10;
+     5cb:	01 d2                	add    %edx,%edx
+     5cd:	89 f8                	mov    %edi,%eax
+     5cf:	29 d0                	sub    %edx,%eax
+     5d1:	83 c0 30             	add    $0x30,%eax
+     5d4:	88 45 d3             	mov    %al,-0x2d(%ebp)
+    if ((fd = open(name, O_CREATE|O_RDWR)) < 0){
+     5d7:	68 02 02 00 00       	push   $0x202
+     5dc:	53                   	push   %ebx
+     5dd:	e8 41 0a 00 00       	call   1023 <open>
+     5e2:	83 c4 10             	add    $0x10,%esp
+     5e5:	85 c0                	test   %eax,%eax
+     5e7:	0f 88 2c 01 00 00    	js     719 <dirlinktest+0x279>
+    close(fd);
+     5ed:	83 ec 0c             	sub    $0xc,%esp
+  for (i = 0; i < 100; i += 2){
+     5f0:	83 c7 02             	add    $0x2,%edi
+    close(fd);
+     5f3:	50                   	push   %eax
+     5f4:	e8 12 0a 00 00       	call   100b <close>
+  for (i = 0; i < 100; i += 2){
+     5f9:	83 c4 10             	add    $0x10,%esp
+     5fc:	83 ff 64             	cmp    $0x64,%edi
+     5ff:	75 b7                	jne    5b8 <dirlinktest+0x118>
+  if (stat("/mnt/dlt", &st) < 0 || st.size != size){
+     601:	83 ec 08             	sub    $0x8,%esp
+     604:	8d 45 b4             	lea    -0x4c(%ebp),%eax
+     607:	50                   	push   %eax
+     608:	68 6a 16 00 00       	push   $0x166a
+     60d:	e8 0e 09 00 00       	call   f20 <stat>
+     612:	83 c4 10             	add    $0x10,%esp
+     615:	85 c0                	test   %eax,%eax
+     617:	0f 88 3b 01 00 00    	js     758 <dirlinktest+0x2b8>
+     61d:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+     620:	3b 45 c4             	cmp    -0x3c(%ebp),%eax
+     623:	0f 85 2f 01 00 00    	jne    758 <dirlinktest+0x2b8>
+  for (i = 0; i < 100; i++){
+     629:	31 f6                	xor    %esi,%esi
+    name[9] = i % 2 ? 'f' : 'g';
+     62b:	bf 67 00 00 00       	mov    $0x67,%edi
+     630:	89 f2                	mov    %esi,%edx
+     632:	89 f8                	mov    %edi,%eax
+    if ((fd = open(name, O_RDONLY)) < 0){
+     634:	83 ec 08             	sub    $0x8,%esp
+    name[9] = i % 2 ? 'f' : 'g';
+     637:	83 e2 01             	and    $0x1,%edx
+     63a:	29 d0                	sub    %edx,%eax
+     63c:	88 45 d1             	mov    %al,-0x2f(%ebp)
+    name[10] = '0' + i / 10;
+     63f:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+     644:	f7 e6                	mul    %esi
+     646:	c1 ea 03             	shr    $0x3,%edx
+     649:	8d 42 30             	lea    0x30(%edx),%eax
+    name[11] = '0' + i % 10;
+     64c:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    name[10] = '0' + i / 10;
+     64f:	88 45 d2             	mov    %al,-0x2e(%ebp)
+    name[11] = '0' + i % 10;
+     652:	01 d2                	add    %edx,%edx
+     654:	89 f0                	mov    %esi,%eax
+     656:	29 d0                	sub    %edx,%eax
+     658:	83 c0 30             	add    $0x30,%eax
+     65b:	88 45 d3             	mov    %al,-0x2d(%ebp)
+    if ((fd = open(name, O_RDONLY)) < 0){
+     65e:	6a 00                	push   $0x0
+     660:	53                   	push   %ebx
+     661:	e8 bd 09 00 00       	call   1023 <open>
+     666:	83 c4 10             	add    $0x10,%esp
+     669:	85 c0                	test   %eax,%eax
+     66b:	0f 88 d2 00 00 00    	js     743 <dirlinktest+0x2a3>
+    close(fd);
+     671:	83 ec 0c             	sub    $0xc,%esp
+  for (i = 0; i < 100; i++){
+     674:	83 c6 01             	add    $0x1,%esi
+    close(fd);
+     677:	50                   	push   %eax
+     678:	e8 8e 09 00 00       	call   100b <close>
+  for (i = 0; i < 100; i++){
+     67d:	83 c4 10             	add    $0x10,%esp
+     680:	83 fe 64             	cmp    $0x64,%esi
+     683:	75 ab                	jne    630 <dirlinktest+0x190>
+  if (unlink("/mnt/dlt") == 0){
+     685:	83 ec 0c             	sub    $0xc,%esp
+     688:	68 6a 16 00 00       	push   $0x166a
+     68d:	e8 a1 09 00 00       	call   1033 <unlink>
+     692:	83 c4 10             	add    $0x10,%esp
+     695:	85 c0                	test   %eax,%eax
+     697:	0f 84 e5 00 00 00    	je     782 <dirlinktest+0x2e2>
+  for (i = 0; i < 100; i++){
+     69d:	31 f6                	xor    %esi,%esi
+    name[9] = i % 2 ? 'f' : 'g';
+     69f:	bf 67 00 00 00       	mov    $0x67,%edi
+     6a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6a8:	89 f2                	mov    %esi,%edx
+     6aa:	89 f8                	mov    %edi,%eax
+    if (unlink(name) < 0){
+     6ac:	83 ec 0c             	sub    $0xc,%esp
+    name[9] = i % 2 ? 'f' : 'g';
+     6af:	83 e2 01             	and    $0x1,%edx
+     6b2:	29 d0                	sub    %edx,%eax
+     6b4:	88 45 d1             	mov    %al,-0x2f(%ebp)
+    name[10] = '0' + i / 10;
+     6b7:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+     6bc:	f7 e6                	mul    %esi
+     6be:	c1 ea 03             	shr    $0x3,%edx
+     6c1:	8d 42 30             	lea    0x30(%edx),%eax
+    name[11] = '0' + i % 10;
+     6c4:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    name[10] = '0' + i / 10;
+     6c7:	88 45 d2             	mov    %al,-0x2e(%ebp)
+    name[11] = '0' + i % 10;
+     6ca:	01 d2                	add    %edx,%edx
+     6cc:	89 f0                	mov    %esi,%eax
+     6ce:	29 d0                	sub    %edx,%eax
+     6d0:	83 c0 30             	add    $0x30,%eax
+     6d3:	88 45 d3             	mov    %al,-0x2d(%ebp)
+    if (unlink(name) < 0){
+     6d6:	53                   	push   %ebx
+     6d7:	e8 57 09 00 00       	call   1033 <unlink>
+     6dc:	83 c4 10             	add    $0x10,%esp
+     6df:	85 c0                	test   %eax,%eax
+     6e1:	78 4b                	js     72e <dirlinktest+0x28e>
+  for (i = 0; i < 100; i++){
+     6e3:	83 c6 01             	add    $0x1,%esi
+     6e6:	83 fe 64             	cmp    $0x64,%esi
+     6e9:	75 bd                	jne    6a8 <dirlinktest+0x208>
+  if (unlink("/mnt/dlt") < 0){
+     6eb:	83 ec 0c             	sub    $0xc,%esp
+     6ee:	68 6a 16 00 00       	push   $0x166a
+     6f3:	e8 3b 09 00 00       	call   1033 <unlink>
+     6f8:	83 c4 10             	add    $0x10,%esp
+     6fb:	85 c0                	test   %eax,%eax
+     6fd:	78 70                	js     76f <dirlinktest+0x2cf>
+  printf(1, "dirlinktest passed\n");
+     6ff:	83 ec 08             	sub    $0x8,%esp
+     702:	68 19 17 00 00       	push   $0x1719
+     707:	6a 01                	push   $0x1
+     709:	e8 32 0a 00 00       	call   1140 <printf>
+}
+     70e:	83 c4 10             	add    $0x10,%esp
+     711:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     714:	5b                   	pop    %ebx
+     715:	5e                   	pop    %esi
+     716:	5f                   	pop    %edi
+     717:	5d                   	pop    %ebp
+     718:	c3                   	ret
+      printf(1, "create %s failed\n", name);
+     719:	83 ec 04             	sub    $0x4,%esp
+     71c:	53                   	push   %ebx
+     71d:	68 96 16 00 00       	push   $0x1696
+     722:	6a 01                	push   $0x1
+     724:	e8 17 0a 00 00       	call   1140 <printf>
+      exit();
+     729:	e8 b5 08 00 00       	call   fe3 <exit>
+      printf(1, "unlink %s failed\n", name);
+     72e:	83 ec 04             	sub    $0x4,%esp
+     731:	53                   	push   %ebx
+     732:	68 bf 16 00 00       	push   $0x16bf
+     737:	6a 01                	push   $0x1
+     739:	e8 02 0a 00 00       	call   1140 <printf>
+      exit();
+     73e:	e8 a0 08 00 00       	call   fe3 <exit>
+      printf(1, "open %s failed\n", name);
+     743:	83 ec 04             	sub    $0x4,%esp
+     746:	53                   	push   %ebx
+     747:	68 eb 16 00 00       	push   $0x16eb
+     74c:	6a 01                	push   $0x1
+     74e:	e8 ed 09 00 00       	call   1140 <printf>
+      exit();
+     753:	e8 8b 08 00 00       	call   fe3 <exit>
+    printf(1, "directory grew: %d -> %d\n", size, st.size);
+     758:	ff 75 c4             	push   -0x3c(%ebp)
+     75b:	ff 75 a4             	push   -0x5c(%ebp)
+     75e:	68 d1 16 00 00       	push   $0x16d1
+     763:	6a 01                	push   $0x1
+     765:	e8 d6 09 00 00       	call   1140 <printf>
+    exit();
+     76a:	e8 74 08 00 00       	call   fe3 <exit>
+    printf(1, "unlink empty directory failed\n");
+     76f:	50                   	push   %eax
+     770:	50                   	push   %eax
+     771:	68 5c 18 00 00       	push   $0x185c
+     776:	6a 01                	push   $0x1
+     778:	e8 c3 09 00 00       	call   1140 <printf>
+    exit();
+     77d:	e8 61 08 00 00       	call   fe3 <exit>
+    printf(1, "unlinked non-empty directory\n");
+     782:	52                   	push   %edx
+     783:	52                   	push   %edx
+     784:	68 fb 16 00 00       	push   $0x16fb
+     789:	6a 01                	push   $0x1
+     78b:	e8 b0 09 00 00       	call   1140 <printf>
+    exit();
+     790:	e8 4e 08 00 00       	call   fe3 <exit>
+    printf(1, "mkdir in ext2 failed\n");
+     795:	53                   	push   %ebx
+     796:	53                   	push   %ebx
+     797:	68 73 16 00 00       	push   $0x1673
+     79c:	6a 01                	push   $0x1
+     79e:	e8 9d 09 00 00       	call   1140 <printf>
+    exit();
+     7a3:	e8 3b 08 00 00       	call   fe3 <exit>
+    printf(1, "directory too big: %d\n", st.size);
+     7a8:	51                   	push   %ecx
+     7a9:	ff 75 c4             	push   -0x3c(%ebp)
+     7ac:	68 a8 16 00 00       	push   $0x16a8
+     7b1:	6a 01                	push   $0x1
+     7b3:	e8 88 09 00 00       	call   1140 <printf>
+    exit();
+     7b8:	e8 26 08 00 00       	call   fe3 <exit>
+     7bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000007c0 <dirsynctest>:
+{
+     7c0:	55                   	push   %ebp
+     7c1:	89 e5                	mov    %esp,%ebp
+     7c3:	57                   	push   %edi
+     7c4:	56                   	push   %esi
+     7c5:	53                   	push   %ebx
+     7c6:	83 ec 54             	sub    $0x54,%esp
+  printf(1, "ext2 dir sync test\n");
+     7c9:	68 2d 17 00 00       	push   $0x172d
+     7ce:	6a 01                	push   $0x1
+     7d0:	e8 6b 09 00 00       	call   1140 <printf>
+  if (mkdir("/mnt/dsync") < 0){
+     7d5:	c7 04 24 41 17 00 00 	movl   $0x1741,(%esp)
+     7dc:	e8 6a 08 00 00       	call   104b <mkdir>
+     7e1:	83 c4 10             	add    $0x10,%esp
+     7e4:	85 c0                	test   %eax,%eax
+     7e6:	0f 88 2f 02 00 00    	js     a1b <dirsynctest+0x25b>
+  strcpy(name, "/mnt/dsync/file00");
+     7ec:	83 ec 08             	sub    $0x8,%esp
+     7ef:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  for (i = 0; i < 80; i++){
+     7f2:	31 f6                	xor    %esi,%esi
+    name[15] = '0' + i / 10;
+     7f4:	bb cd cc cc cc       	mov    $0xcccccccd,%ebx
+  strcpy(name, "/mnt/dsync/file00");
+     7f9:	68 4c 17 00 00       	push   $0x174c
+     7fe:	50                   	push   %eax
+     7ff:	e8 9c 05 00 00       	call   da0 <strcpy>
+     804:	83 c4 10             	add    $0x10,%esp
+     807:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     80e:	66 90                	xchg   %ax,%ax
+    name[15] = '0' + i / 10;
+     810:	89 f0                	mov    %esi,%eax
+    if ((fd = open(name, O_CREATE|O_RDWR)) < 0){
+     812:	83 ec 08             	sub    $0x8,%esp
+    name[15] = '0' + i / 10;
+     815:	f7 e3                	mul    %ebx
+     817:	c1 ea 03             	shr    $0x3,%edx
+     81a:	8d 42 30             	lea    0x30(%edx),%eax
+    name[16] = '0' + i % 10;
+     81d:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    name[15] = '0' + i / 10;
+     820:	88 45 d7             	mov    %al,-0x29(%ebp)
+    name[16] = '0' + i % 10;
+     823:	01 d2                	add    %edx,%edx
+     825:	89 f0                	mov    %esi,%eax
+     827:	29 d0                	sub    %edx,%eax
+     829:	83 c0 30             	add    $0x30,%eax
+     82c:	88 45 d8             	mov    %al,-0x28(%ebp)
+    if ((fd = open(name, O_CREATE|O_RDWR)) < 0){
+     82f:	8d 45 c8             	lea    -0x38(%ebp),%eax
+     832:	68 02 02 00 00       	push   $0x202
+     837:	50                   	push   %eax
+     838:	e8 e6 07 00 00       	call   1023 <open>
+     83d:	83 c4 10             	add    $0x10,%esp
+     840:	85 c0                	test   %eax,%eax
+     842:	0f 88 95 01 00 00    	js     9dd <dirsynctest+0x21d>
+    close(fd);
+     848:	83 ec 0c             	sub    $0xc,%esp
+  for (i = 0; i < 80; i++){
+     84b:	83 c6 01             	add    $0x1,%esi
+    close(fd);
+     84e:	50                   	push   %eax
+     84f:	e8 b7 07 00 00       	call   100b <close>
+  for (i = 0; i < 80; i++){
+     854:	83 c4 10             	add    $0x10,%esp
+     857:	83 fe 50             	cmp    $0x50,%esi
+     85a:	75 b4                	jne    810 <dirsynctest+0x50>
+  if (sync() < 0){
+     85c:	e8 22 08 00 00       	call   1083 <sync>
+     861:	85 c0                	test   %eax,%eax
+     863:	0f 88 9f 01 00 00    	js     a08 <dirsynctest+0x248>
+  if ((fd = open("/mnt/dsync", O_RDONLY)) < 0){
+     869:	83 ec 08             	sub    $0x8,%esp
+     86c:	6a 00                	push   $0x0
+     86e:	68 41 17 00 00       	push   $0x1741
+     873:	e8 ab 07 00 00       	call   1023 <open>
+     878:	83 c4 10             	add    $0x10,%esp
+     87b:	85 c0                	test   %eax,%eax
+     87d:	0f 88 72 01 00 00    	js     9f5 <dirsynctest+0x235>
+  found = 0;
+     883:	c7 45 b0 00 00 00 00 	movl   $0x0,-0x50(%ebp)
+     88a:	8d 75 c4             	lea    -0x3c(%ebp),%esi
+     88d:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  while ((n = read(fd, buf, 1024)) == 1024){
+     890:	83 ec 04             	sub    $0x4,%esp
+     893:	68 00 04 00 00       	push   $0x400
+     898:	68 60 1d 00 00       	push   $0x1d60
+     89d:	ff 75 b4             	push   -0x4c(%ebp)
+     8a0:	e8 56 07 00 00       	call   ffb <read>
+     8a5:	83 c4 10             	add    $0x10,%esp
+     8a8:	3d 00 04 00 00       	cmp    $0x400,%eax
+     8ad:	0f 85 83 00 00 00    	jne    936 <dirsynctest+0x176>
+    for (off = 0; off < 1024; off += reclen){
+     8b3:	31 ff                	xor    %edi,%edi
+     8b5:	8d 5d c2             	lea    -0x3e(%ebp),%ebx
+     8b8:	eb 0f                	jmp    8c9 <dirsynctest+0x109>
+     8ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     8c0:	3d 00 04 00 00       	cmp    $0x400,%eax
+     8c5:	74 c9                	je     890 <dirsynctest+0xd0>
+     8c7:	89 c7                	mov    %eax,%edi
+      memmove(&ino, buf + off, 4);
+     8c9:	83 ec 04             	sub    $0x4,%esp
+     8cc:	8d 87 60 1d 00 00    	lea    0x1d60(%edi),%eax
+     8d2:	6a 04                	push   $0x4
+     8d4:	50                   	push   %eax
+     8d5:	56                   	push   %esi
+     8d6:	e8 d5 06 00 00       	call   fb0 <memmove>
+      memmove(&reclen, buf + off + 4, 2);
+     8db:	83 c4 0c             	add    $0xc,%esp
+     8de:	8d 87 64 1d 00 00    	lea    0x1d64(%edi),%eax
+     8e4:	6a 02                	push   $0x2
+     8e6:	50                   	push   %eax
+     8e7:	53                   	push   %ebx
+     8e8:	e8 c3 06 00 00       	call   fb0 <memmove>
+      if (reclen < 12 || off + reclen > 1024){
+     8ed:	0f b7 45 c2          	movzwl -0x3e(%ebp),%eax
+      namelen = buf[off + 6];
+     8f1:	0f b6 97 66 1d 00 00 	movzbl 0x1d66(%edi),%edx
+      if (reclen < 12 || off + reclen > 1024){
+     8f8:	83 c4 10             	add    $0x10,%esp
+     8fb:	66 83 f8 0b          	cmp    $0xb,%ax
+     8ff:	0f 86 c4 00 00 00    	jbe    9c9 <dirsynctest+0x209>
+     905:	01 f8                	add    %edi,%eax
+     907:	3d 00 04 00 00       	cmp    $0x400,%eax
+     90c:	0f 8f b7 00 00 00    	jg     9c9 <dirsynctest+0x209>
+      if (ino != 0 && namelen == 6 && buf[off + 8] == 'f' && buf[off + 11] == 'e')
+     912:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+     915:	85 c9                	test   %ecx,%ecx
+     917:	74 a7                	je     8c0 <dirsynctest+0x100>
+     919:	80 fa 06             	cmp    $0x6,%dl
+     91c:	75 a2                	jne    8c0 <dirsynctest+0x100>
+     91e:	80 bf 68 1d 00 00 66 	cmpb   $0x66,0x1d68(%edi)
+     925:	75 99                	jne    8c0 <dirsynctest+0x100>
+     927:	80 bf 6b 1d 00 00 65 	cmpb   $0x65,0x1d6b(%edi)
+     92e:	75 90                	jne    8c0 <dirsynctest+0x100>
+        found++;
+     930:	83 45 b0 01          	addl   $0x1,-0x50(%ebp)
+     934:	eb 8a                	jmp    8c0 <dirsynctest+0x100>
+  close(fd);
+     936:	8b 4d b4             	mov    -0x4c(%ebp),%ecx
+     939:	83 ec 0c             	sub    $0xc,%esp
+     93c:	89 c3                	mov    %eax,%ebx
+     93e:	51                   	push   %ecx
+     93f:	e8 c7 06 00 00       	call   100b <close>
+  if (n != 0 || found != 80){
+     944:	83 c4 10             	add    $0x10,%esp
+     947:	85 db                	test   %ebx,%ebx
+     949:	0f 85 11 01 00 00    	jne    a60 <dirsynctest+0x2a0>
+     94f:	83 7d b0 50          	cmpl   $0x50,-0x50(%ebp)
+     953:	0f 85 07 01 00 00    	jne    a60 <dirsynctest+0x2a0>
+  for (i = 0; i < 80; i++){
+     959:	31 f6                	xor    %esi,%esi
+    name[15] = '0' + i / 10;
+     95b:	bb cd cc cc cc       	mov    $0xcccccccd,%ebx
+     960:	89 f0                	mov    %esi,%eax
+    if (unlink(name) < 0){
+     962:	83 ec 0c             	sub    $0xc,%esp
+    name[15] = '0' + i / 10;
+     965:	f7 e3                	mul    %ebx
+     967:	c1 ea 03             	shr    $0x3,%edx
+     96a:	8d 42 30             	lea    0x30(%edx),%eax
+    name[16] = '0' + i % 10;
+     96d:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    name[15] = '0' + i / 10;
+     970:	88 45 d7             	mov    %al,-0x29(%ebp)
+    name[16] = '0' + i % 10;
+     973:	01 d2                	add    %edx,%edx
+     975:	89 f0                	mov    %esi,%eax
+     977:	29 d0                	sub    %edx,%eax
+     979:	83 c0 30             	add    $0x30,%eax
+     97c:	88 45 d8             	mov    %al,-0x28(%ebp)
+    if (unlink(name) < 0){
+     97f:	8d 45 c8             	lea    -0x38(%ebp),%eax
+     982:	50                   	push   %eax
+     983:	e8 ab 06 00 00       	call   1033 <unlink>
+     988:	83 c4 10             	add    $0x10,%esp
+     98b:	85 c0                	test   %eax,%eax
+     98d:	0f 88 b5 00 00 00    	js     a48 <dirsynctest+0x288>
+  for (i = 0; i < 80; i++){
+     993:	83 c6 01             	add    $0x1,%esi
+     996:	83 fe 50             	cmp    $0x50,%esi
+     999:	75 c5                	jne    960 <dirsynctest+0x1a0>
+  if (unlink("/mnt/dsync") < 0){
+     99b:	83 ec 0c             	sub    $0xc,%esp
+     99e:	68 41 17 00 00       	push   $0x1741
+     9a3:	e8 8b 06 00 00       	call   1033 <unlink>
+     9a8:	83 c4 10             	add    $0x10,%esp
+     9ab:	85 c0                	test   %eax,%eax
+     9ad:	78 7f                	js     a2e <dirsynctest+0x26e>
+  printf(1, "dirsynctest passed\n");
+     9af:	83 ec 08             	sub    $0x8,%esp
+     9b2:	68 8e 17 00 00       	push   $0x178e
+     9b7:	6a 01                	push   $0x1
+     9b9:	e8 82 07 00 00       	call   1140 <printf>
+}
+     9be:	83 c4 10             	add    $0x10,%esp
+     9c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     9c4:	5b                   	pop    %ebx
+     9c5:	5e                   	pop    %esi
+     9c6:	5f                   	pop    %edi
+     9c7:	5d                   	pop    %ebp
+     9c8:	c3                   	ret
+        printf(1, "bad directory block after sync\n");
+     9c9:	83 ec 08             	sub    $0x8,%esp
+     9cc:	68 7c 18 00 00       	push   $0x187c
+     9d1:	6a 01                	push   $0x1
+     9d3:	e8 68 07 00 00       	call   1140 <printf>
+        exit();
+     9d8:	e8 06 06 00 00       	call   fe3 <exit>
+      printf(1, "create %s failed\n", name);
+     9dd:	83 ec 04             	sub    $0x4,%esp
+     9e0:	8d 45 c8             	lea    -0x38(%ebp),%eax
+     9e3:	50                   	push   %eax
+     9e4:	68 96 16 00 00       	push   $0x1696
+     9e9:	6a 01                	push   $0x1
+     9eb:	e8 50 07 00 00       	call   1140 <printf>
+      exit();
+     9f0:	e8 ee 05 00 00       	call   fe3 <exit>
+    printf(1, "open directory failed\n");
+     9f5:	53                   	push   %ebx
+     9f6:	53                   	push   %ebx
+     9f7:	68 5e 17 00 00       	push   $0x175e
+     9fc:	6a 01                	push   $0x1
+     9fe:	e8 3d 07 00 00       	call   1140 <printf>
+    exit();
+     a03:	e8 db 05 00 00       	call   fe3 <exit>
+    printf(1, "sync failed\n");
+     a08:	56                   	push   %esi
+     a09:	56                   	push   %esi
+     a0a:	68 a8 15 00 00       	push   $0x15a8
+     a0f:	6a 01                	push   $0x1
+     a11:	e8 2a 07 00 00       	call   1140 <printf>
+    exit();
+     a16:	e8 c8 05 00 00       	call   fe3 <exit>
+    printf(1, "mkdir in ext2 failed\n");
+     a1b:	57                   	push   %edi
+     a1c:	57                   	push   %edi
+     a1d:	68 73 16 00 00       	push   $0x1673
+     a22:	6a 01                	push   $0x1
+     a24:	e8 17 07 00 00       	call   1140 <printf>
+    exit();
+     a29:	e8 b5 05 00 00       	call   fe3 <exit>
+    printf(1, "unlink directory failed\n");
+     a2e:	50                   	push   %eax
+     a2f:	50                   	push   %eax
+     a30:	68 75 17 00 00       	push   $0x1775
+     a35:	6a 01                	push   $0x1
+     a37:	e8 04 07 00 00       	call   1140 <printf>
+    exit();
+     a3c:	e8 a2 05 00 00       	call   fe3 <exit>
+     a41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      printf(1, "unlink %s failed\n", name);
+     a48:	83 ec 04             	sub    $0x4,%esp
+     a4b:	8d 45 c8             	lea    -0x38(%ebp),%eax
+     a4e:	50                   	push   %eax
+     a4f:	68 bf 16 00 00       	push   $0x16bf
+     a54:	6a 01                	push   $0x1
+     a56:	e8 e5 06 00 00       	call   1140 <printf>
+      exit();
+     a5b:	e8 83 05 00 00       	call   fe3 <exit>
+    printf(1, "found %d of 80 names after sync\n", found);
+     a60:	52                   	push   %edx
+     a61:	ff 75 b0             	push   -0x50(%ebp)
+     a64:	68 9c 18 00 00       	push   $0x189c
+     a69:	6a 01                	push   $0x1
+     a6b:	e8 d0 06 00 00       	call   1140 <printf>
+    exit();
+     a70:	e8 6e 05 00 00       	call   fe3 <exit>
+     a75:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a80 <htreetest>:
+{
+     a80:	55                   	push   %ebp
+     a81:	89 e5                	mov    %esp,%ebp
+     a83:	57                   	push   %edi
+     a84:	56                   	push   %esi
+     a85:	53                   	push   %ebx
+     a86:	83 ec 64             	sub    $0x64,%esp
+  printf(1, "ext2 htree test\n");
+     a89:	68 a2 17 00 00       	push   $0x17a2
+     a8e:	6a 01                	push   $0x1
+     a90:	e8 ab 06 00 00       	call   1140 <printf>
+  if (mkdir("/mnt/htree") < 0 ||
+     a95:	c7 04 24 b3 17 00 00 	movl   $0x17b3,(%esp)
+     a9c:	e8 aa 05 00 00       	call   104b <mkdir>
+     aa1:	83 c4 10             	add    $0x10,%esp
+     aa4:	85 c0                	test   %eax,%eax
+     aa6:	0f 88 c1 02 00 00    	js     d6d <htreetest+0x2ed>
+      (fd = open("/mnt/htree/target", O_CREATE|O_RDWR)) < 0){
+     aac:	83 ec 08             	sub    $0x8,%esp
+     aaf:	68 02 02 00 00       	push   $0x202
+     ab4:	68 d2 17 00 00       	push   $0x17d2
+     ab9:	e8 65 05 00 00       	call   1023 <open>
+  if (mkdir("/mnt/htree") < 0 ||
+     abe:	83 c4 10             	add    $0x10,%esp
+     ac1:	85 c0                	test   %eax,%eax
+     ac3:	0f 88 a4 02 00 00    	js     d6d <htreetest+0x2ed>
+  close(fd);
+     ac9:	83 ec 0c             	sub    $0xc,%esp
+     acc:	8d 5d c8             	lea    -0x38(%ebp),%ebx
+    name[j] = '0' + i % 10;
+     acf:	bf cd cc cc cc       	mov    $0xcccccccd,%edi
+  close(fd);
+     ad4:	50                   	push   %eax
+     ad5:	e8 31 05 00 00       	call   100b <close>
+  for (i = 0; i < NHTREE; i++){
+     ada:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  close(fd);
+     ae1:	83 c4 10             	add    $0x10,%esp
+     ae4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  strcpy(name, "/mnt/htree/h00000abcdefg");
+     ae8:	83 ec 08             	sub    $0x8,%esp
+  for (j = 16; j > 11; j--, i /= 10)
+     aeb:	be 10 00 00 00       	mov    $0x10,%esi
+  strcpy(name, "/mnt/htree/h00000abcdefg");
+     af0:	68 e4 17 00 00       	push   $0x17e4
+     af5:	53                   	push   %ebx
+     af6:	e8 a5 02 00 00       	call   da0 <strcpy>
+     afb:	8b 4d a4             	mov    -0x5c(%ebp),%ecx
+     afe:	83 c4 10             	add    $0x10,%esp
+     b01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    name[j] = '0' + i % 10;
+     b08:	89 c8                	mov    %ecx,%eax
+     b0a:	f7 e7                	mul    %edi
+     b0c:	c1 ea 03             	shr    $0x3,%edx
+     b0f:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     b12:	01 c0                	add    %eax,%eax
+     b14:	29 c1                	sub    %eax,%ecx
+     b16:	83 c1 30             	add    $0x30,%ecx
+     b19:	88 0c 33             	mov    %cl,(%ebx,%esi,1)
+  for (j = 16; j > 11; j--, i /= 10)
+     b1c:	83 ee 01             	sub    $0x1,%esi
+     b1f:	89 d1                	mov    %edx,%ecx
+     b21:	83 fe 0b             	cmp    $0xb,%esi
+     b24:	75 e2                	jne    b08 <htreetest+0x88>
+    if (link("/mnt/htree/target", name) < 0){
+     b26:	83 ec 08             	sub    $0x8,%esp
+     b29:	53                   	push   %ebx
+     b2a:	68 d2 17 00 00       	push   $0x17d2
+     b2f:	e8 0f 05 00 00       	call   1043 <link>
+     b34:	83 c4 10             	add    $0x10,%esp
+     b37:	85 c0                	test   %eax,%eax
+     b39:	0f 88 c7 01 00 00    	js     d06 <htreetest+0x286>
+  for (i = 0; i < NHTREE; i++){
+     b3f:	83 45 a4 01          	addl   $0x1,-0x5c(%ebp)
+     b43:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+     b46:	3d 88 13 00 00       	cmp    $0x1388,%eax
+     b4b:	75 9b                	jne    ae8 <htreetest+0x68>
+  if (stat("/mnt/htree", &st) < 0 || st.size <= 125 * 1024){
+     b4d:	83 ec 08             	sub    $0x8,%esp
+     b50:	8d 45 b4             	lea    -0x4c(%ebp),%eax
+     b53:	50                   	push   %eax
+     b54:	68 b3 17 00 00       	push   $0x17b3
+     b59:	e8 c2 03 00 00       	call   f20 <stat>
+     b5e:	83 c4 10             	add    $0x10,%esp
+     b61:	85 c0                	test   %eax,%eax
+     b63:	0f 88 ef 01 00 00    	js     d58 <htreetest+0x2d8>
+     b69:	81 7d c4 00 f4 01 00 	cmpl   $0x1f400,-0x3c(%ebp)
+     b70:	0f 86 e2 01 00 00    	jbe    d58 <htreetest+0x2d8>
+  for (i = 0; i < NHTREE; i++){
+     b76:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+    name[j] = '0' + i % 10;
+     b7d:	be cd cc cc cc       	mov    $0xcccccccd,%esi
+     b82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  strcpy(name, "/mnt/htree/h00000abcdefg");
+     b88:	83 ec 08             	sub    $0x8,%esp
+  for (j = 16; j > 11; j--, i /= 10)
+     b8b:	bf 10 00 00 00       	mov    $0x10,%edi
+  strcpy(name, "/mnt/htree/h00000abcdefg");
+     b90:	68 e4 17 00 00       	push   $0x17e4
+     b95:	53                   	push   %ebx
+     b96:	e8 05 02 00 00       	call   da0 <strcpy>
+     b9b:	8b 4d a4             	mov    -0x5c(%ebp),%ecx
+     b9e:	83 c4 10             	add    $0x10,%esp
+     ba1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    name[j] = '0' + i % 10;
+     ba8:	89 c8                	mov    %ecx,%eax
+     baa:	f7 e6                	mul    %esi
+     bac:	c1 ea 03             	shr    $0x3,%edx
+     baf:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     bb2:	01 c0                	add    %eax,%eax
+     bb4:	29 c1                	sub    %eax,%ecx
+     bb6:	83 c1 30             	add    $0x30,%ecx
+     bb9:	88 0c 3b             	mov    %cl,(%ebx,%edi,1)
+  for (j = 16; j > 11; j--, i /= 10)
+     bbc:	83 ef 01             	sub    $0x1,%edi
+     bbf:	89 d1                	mov    %edx,%ecx
+     bc1:	83 ff 0b             	cmp    $0xb,%edi
+     bc4:	75 e2                	jne    ba8 <htreetest+0x128>
+    if ((fd = open(name, O_RDONLY)) < 0){
+     bc6:	83 ec 08             	sub    $0x8,%esp
+     bc9:	6a 00                	push   $0x0
+     bcb:	53                   	push   %ebx
+     bcc:	e8 52 04 00 00       	call   1023 <open>
+     bd1:	83 c4 10             	add    $0x10,%esp
+     bd4:	85 c0                	test   %eax,%eax
+     bd6:	0f 88 54 01 00 00    	js     d30 <htreetest+0x2b0>
+    close(fd);
+     bdc:	83 ec 0c             	sub    $0xc,%esp
+     bdf:	50                   	push   %eax
+     be0:	e8 26 04 00 00       	call   100b <close>
+  for (i = 0; i < NHTREE; i++){
+     be5:	83 45 a4 01          	addl   $0x1,-0x5c(%ebp)
+     be9:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+     bec:	83 c4 10             	add    $0x10,%esp
+     bef:	3d 88 13 00 00       	cmp    $0x1388,%eax
+     bf4:	75 92                	jne    b88 <htreetest+0x108>
+  strcpy(name, "/mnt/htree/h00000abcdefg");
+     bf6:	83 ec 08             	sub    $0x8,%esp
+    name[j] = '0' + i % 10;
+     bf9:	be 67 66 66 66       	mov    $0x66666667,%esi
+  strcpy(name, "/mnt/htree/h00000abcdefg");
+     bfe:	68 e4 17 00 00       	push   $0x17e4
+     c03:	53                   	push   %ebx
+     c04:	e8 97 01 00 00       	call   da0 <strcpy>
+    name[j] = '0' + i % 10;
+     c09:	8b 7d a4             	mov    -0x5c(%ebp),%edi
+  strcpy(name, "/mnt/htree/h00000abcdefg");
+     c0c:	83 c4 10             	add    $0x10,%esp
+  for (j = 16; j > 11; j--, i /= 10)
+     c0f:	b9 10 00 00 00       	mov    $0x10,%ecx
+    name[j] = '0' + i % 10;
+     c14:	89 f8                	mov    %edi,%eax
+     c16:	f7 ee                	imul   %esi
+     c18:	89 f8                	mov    %edi,%eax
+     c1a:	c1 f8 1f             	sar    $0x1f,%eax
+     c1d:	c1 fa 02             	sar    $0x2,%edx
+     c20:	29 c2                	sub    %eax,%edx
+     c22:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     c25:	01 c0                	add    %eax,%eax
+     c27:	29 c7                	sub    %eax,%edi
+     c29:	8d 47 30             	lea    0x30(%edi),%eax
+  for (j = 16; j > 11; j--, i /= 10)
+     c2c:	89 d7                	mov    %edx,%edi
+    name[j] = '0' + i % 10;
+     c2e:	88 04 0b             	mov    %al,(%ebx,%ecx,1)
+  for (j = 16; j > 11; j--, i /= 10)
+     c31:	83 e9 01             	sub    $0x1,%ecx
+     c34:	83 f9 0b             	cmp    $0xb,%ecx
+     c37:	75 db                	jne    c14 <htreetest+0x194>
+  if ((fd = open(name, O_RDONLY)) >= 0){
+     c39:	83 ec 08             	sub    $0x8,%esp
+     c3c:	6a 00                	push   $0x0
+     c3e:	53                   	push   %ebx
+     c3f:	e8 df 03 00 00       	call   1023 <open>
+     c44:	83 c4 10             	add    $0x10,%esp
+     c47:	85 c0                	test   %eax,%eax
+     c49:	0f 89 f6 00 00 00    	jns    d45 <htreetest+0x2c5>
+  for (i = 0; i < NHTREE; i++){
+     c4f:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+    name[j] = '0' + i % 10;
+     c56:	bf cd cc cc cc       	mov    $0xcccccccd,%edi
+     c5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c5f:	90                   	nop
+  strcpy(name, "/mnt/htree/h00000abcdefg");
+     c60:	83 ec 08             	sub    $0x8,%esp
+  for (j = 16; j > 11; j--, i /= 10)
+     c63:	be 10 00 00 00       	mov    $0x10,%esi
+  strcpy(name, "/mnt/htree/h00000abcdefg");
+     c68:	68 e4 17 00 00       	push   $0x17e4
+     c6d:	53                   	push   %ebx
+     c6e:	e8 2d 01 00 00       	call   da0 <strcpy>
+     c73:	8b 4d a4             	mov    -0x5c(%ebp),%ecx
+     c76:	83 c4 10             	add    $0x10,%esp
+     c79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    name[j] = '0' + i % 10;
+     c80:	89 c8                	mov    %ecx,%eax
+     c82:	f7 e7                	mul    %edi
+     c84:	c1 ea 03             	shr    $0x3,%edx
+     c87:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     c8a:	01 c0                	add    %eax,%eax
+     c8c:	29 c1                	sub    %eax,%ecx
+     c8e:	83 c1 30             	add    $0x30,%ecx
+     c91:	88 0c 33             	mov    %cl,(%ebx,%esi,1)
+  for (j = 16; j > 11; j--, i /= 10)
+     c94:	83 ee 01             	sub    $0x1,%esi
+     c97:	89 d1                	mov    %edx,%ecx
+     c99:	83 fe 0b             	cmp    $0xb,%esi
+     c9c:	75 e2                	jne    c80 <htreetest+0x200>
+    if (unlink(name) < 0){
+     c9e:	83 ec 0c             	sub    $0xc,%esp
+     ca1:	53                   	push   %ebx
+     ca2:	e8 8c 03 00 00       	call   1033 <unlink>
+     ca7:	83 c4 10             	add    $0x10,%esp
+     caa:	85 c0                	test   %eax,%eax
+     cac:	78 6d                	js     d1b <htreetest+0x29b>
+  for (i = 0; i < NHTREE; i++){
+     cae:	83 45 a4 01          	addl   $0x1,-0x5c(%ebp)
+     cb2:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+     cb5:	3d 88 13 00 00       	cmp    $0x1388,%eax
+     cba:	75 a4                	jne    c60 <htreetest+0x1e0>
+  if (unlink("/mnt/htree/target") < 0 || unlink("/mnt/htree") < 0){
+     cbc:	83 ec 0c             	sub    $0xc,%esp
+     cbf:	68 d2 17 00 00       	push   $0x17d2
+     cc4:	e8 6a 03 00 00       	call   1033 <unlink>
+     cc9:	83 c4 10             	add    $0x10,%esp
+     ccc:	85 c0                	test   %eax,%eax
+     cce:	0f 88 ac 00 00 00    	js     d80 <htreetest+0x300>
+     cd4:	83 ec 0c             	sub    $0xc,%esp
+     cd7:	68 b3 17 00 00       	push   $0x17b3
+     cdc:	e8 52 03 00 00       	call   1033 <unlink>
+     ce1:	83 c4 10             	add    $0x10,%esp
+     ce4:	85 c0                	test   %eax,%eax
+     ce6:	0f 88 94 00 00 00    	js     d80 <htreetest+0x300>
+  printf(1, "htreetest passed\n");
+     cec:	83 ec 08             	sub    $0x8,%esp
+     cef:	68 26 18 00 00       	push   $0x1826
+     cf4:	6a 01                	push   $0x1
+     cf6:	e8 45 04 00 00       	call   1140 <printf>
+     cfb:	83 c4 10             	add    $0x10,%esp
+}
+     cfe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d01:	5b                   	pop    %ebx
+     d02:	5e                   	pop    %esi
+     d03:	5f                   	pop    %edi
+     d04:	5d                   	pop    %ebp
+     d05:	c3                   	ret
+      printf(1, "link %s failed\n", name);
+     d06:	83 ec 04             	sub    $0x4,%esp
+     d09:	53                   	push   %ebx
+     d0a:	68 c1 16 00 00       	push   $0x16c1
+     d0f:	6a 01                	push   $0x1
+     d11:	e8 2a 04 00 00       	call   1140 <printf>
+      exit();
+     d16:	e8 c8 02 00 00       	call   fe3 <exit>
+      printf(1, "unlink %s failed\n", name);
+     d1b:	83 ec 04             	sub    $0x4,%esp
+     d1e:	53                   	push   %ebx
+     d1f:	68 bf 16 00 00       	push   $0x16bf
+     d24:	6a 01                	push   $0x1
+     d26:	e8 15 04 00 00       	call   1140 <printf>
+      exit();
+     d2b:	e8 b3 02 00 00       	call   fe3 <exit>
+      printf(1, "open %s failed\n", name);
+     d30:	83 ec 04             	sub    $0x4,%esp
+     d33:	53                   	push   %ebx
+     d34:	68 eb 16 00 00       	push   $0x16eb
+     d39:	6a 01                	push   $0x1
+     d3b:	e8 00 04 00 00       	call   1140 <printf>
+      exit();
+     d40:	e8 9e 02 00 00       	call   fe3 <exit>
+    printf(1, "open %s succeeded\n", name);
+     d45:	52                   	push   %edx
+     d46:	53                   	push   %ebx
+     d47:	68 fd 17 00 00       	push   $0x17fd
+     d4c:	6a 01                	push   $0x1
+     d4e:	e8 ed 03 00 00       	call   1140 <printf>
+    exit();
+     d53:	e8 8b 02 00 00       	call   fe3 <exit>
+    printf(1, "htree directory too small: %d\n", st.size);
+     d58:	51                   	push   %ecx
+     d59:	ff 75 c4             	push   -0x3c(%ebp)
+     d5c:	68 c0 18 00 00       	push   $0x18c0
+     d61:	6a 01                	push   $0x1
+     d63:	e8 d8 03 00 00       	call   1140 <printf>
+    exit();
+     d68:	e8 76 02 00 00       	call   fe3 <exit>
+    printf(1, "htree setup failed\n");
+     d6d:	53                   	push   %ebx
+     d6e:	53                   	push   %ebx
+     d6f:	68 be 17 00 00       	push   $0x17be
+     d74:	6a 01                	push   $0x1
+     d76:	e8 c5 03 00 00       	call   1140 <printf>
+    exit();
+     d7b:	e8 63 02 00 00       	call   fe3 <exit>
+    printf(1, "htree cleanup failed\n");
+     d80:	50                   	push   %eax
+     d81:	50                   	push   %eax
+     d82:	68 10 18 00 00       	push   $0x1810
+     d87:	6a 01                	push   $0x1
+     d89:	e8 b2 03 00 00       	call   1140 <printf>
+    exit();
+     d8e:	e8 50 02 00 00       	call   fe3 <exit>
+     d93:	66 90                	xchg   %ax,%ax
+     d95:	66 90                	xchg   %ax,%ax
+     d97:	66 90                	xchg   %ax,%ax
+     d99:	66 90                	xchg   %ax,%ax
+     d9b:	66 90                	xchg   %ax,%ax
+     d9d:	66 90                	xchg   %ax,%ax
+     d9f:	90                   	nop
+
+00000da0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     da0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     da1:	31 c0                	xor    %eax,%eax
+{
+     da3:	89 e5                	mov    %esp,%ebp
+     da5:	53                   	push   %ebx
+     da6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     da9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     dac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     db0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     db4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     db7:	83 c0 01             	add    $0x1,%eax
+     dba:	84 d2                	test   %dl,%dl
+     dbc:	75 f2                	jne    db0 <strcpy+0x10>
+    ;
+  return os;
+}
+     dbe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     dc1:	89 c8                	mov    %ecx,%eax
+     dc3:	c9                   	leave
+     dc4:	c3                   	ret
+     dc5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dcc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000dd0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     dd0:	55                   	push   %ebp
+     dd1:	89 e5                	mov    %esp,%ebp
+     dd3:	53                   	push   %ebx
+     dd4:	8b 55 08             	mov    0x8(%ebp),%edx
+     dd7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     dda:	0f b6 02             	movzbl (%edx),%eax
+     ddd:	84 c0                	test   %al,%al
+     ddf:	75 17                	jne    df8 <strcmp+0x28>
+     de1:	eb 3a                	jmp    e1d <strcmp+0x4d>
+     de3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     de7:	90                   	nop
+     de8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     dec:	83 c2 01             	add    $0x1,%edx
+     def:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     df2:	84 c0                	test   %al,%al
+     df4:	74 1a                	je     e10 <strcmp+0x40>
+    p++, q++;
+     df6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     df8:	0f b6 19             	movzbl (%ecx),%ebx
+     dfb:	38 c3                	cmp    %al,%bl
+     dfd:	74 e9                	je     de8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     dff:	29 d8                	sub    %ebx,%eax
+}
+     e01:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e04:	c9                   	leave
+     e05:	c3                   	ret
+     e06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e0d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     e10:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     e14:	31 c0                	xor    %eax,%eax
+     e16:	29 d8                	sub    %ebx,%eax
+}
+     e18:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e1b:	c9                   	leave
+     e1c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     e1d:	0f b6 19             	movzbl (%ecx),%ebx
+     e20:	31 c0                	xor    %eax,%eax
+     e22:	eb db                	jmp    dff <strcmp+0x2f>
+     e24:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e2f:	90                   	nop
+
+00000e30 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     e30:	55                   	push   %ebp
+     e31:	89 e5                	mov    %esp,%ebp
+     e33:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     e36:	80 3a 00             	cmpb   $0x0,(%edx)
+     e39:	74 15                	je     e50 <strlen+0x20>
+     e3b:	31 c0                	xor    %eax,%eax
+     e3d:	8d 76 00             	lea    0x0(%esi),%esi
+     e40:	83 c0 01             	add    $0x1,%eax
+     e43:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     e47:	89 c1                	mov    %eax,%ecx
+     e49:	75 f5                	jne    e40 <strlen+0x10>
+    ;
+  return n;
+}
+     e4b:	89 c8                	mov    %ecx,%eax
+     e4d:	5d                   	pop    %ebp
+     e4e:	c3                   	ret
+     e4f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     e50:	31 c9                	xor    %ecx,%ecx
+}
+     e52:	5d                   	pop    %ebp
+     e53:	89 c8                	mov    %ecx,%eax
+     e55:	c3                   	ret
+     e56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e60 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     e60:	55                   	push   %ebp
+     e61:	89 e5                	mov    %esp,%ebp
+     e63:	57                   	push   %edi
+     e64:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     e67:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     e6a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     e6d:	89 d7                	mov    %edx,%edi
+     e6f:	fc                   	cld
+     e70:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     e72:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     e75:	89 d0                	mov    %edx,%eax
+     e77:	c9                   	leave
+     e78:	c3                   	ret
+     e79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000e80 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     e80:	55                   	push   %ebp
+     e81:	89 e5                	mov    %esp,%ebp
+     e83:	8b 45 08             	mov    0x8(%ebp),%eax
+     e86:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     e8a:	0f b6 10             	movzbl (%eax),%edx
+     e8d:	84 d2                	test   %dl,%dl
+     e8f:	75 12                	jne    ea3 <strchr+0x23>
+     e91:	eb 1d                	jmp    eb0 <strchr+0x30>
+     e93:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e97:	90                   	nop
+     e98:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     e9c:	83 c0 01             	add    $0x1,%eax
+     e9f:	84 d2                	test   %dl,%dl
+     ea1:	74 0d                	je     eb0 <strchr+0x30>
+    if(*s == c)
+     ea3:	38 d1                	cmp    %dl,%cl
+     ea5:	75 f1                	jne    e98 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     ea7:	5d                   	pop    %ebp
+     ea8:	c3                   	ret
+     ea9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     eb0:	31 c0                	xor    %eax,%eax
+}
+     eb2:	5d                   	pop    %ebp
+     eb3:	c3                   	ret
+     eb4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ebb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ebf:	90                   	nop
+
+00000ec0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     ec0:	55                   	push   %ebp
+     ec1:	89 e5                	mov    %esp,%ebp
+     ec3:	57                   	push   %edi
+     ec4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     ec5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     ec8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     ec9:	31 db                	xor    %ebx,%ebx
+{
+     ecb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     ece:	eb 27                	jmp    ef7 <gets+0x37>
+    cc = read(0, &c, 1);
+     ed0:	83 ec 04             	sub    $0x4,%esp
+     ed3:	6a 01                	push   $0x1
+     ed5:	56                   	push   %esi
+     ed6:	6a 00                	push   $0x0
+     ed8:	e8 1e 01 00 00       	call   ffb <read>
+    if(cc < 1)
+     edd:	83 c4 10             	add    $0x10,%esp
+     ee0:	85 c0                	test   %eax,%eax
+     ee2:	7e 1d                	jle    f01 <gets+0x41>
+      break;
+    buf[i++] = c;
+     ee4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     ee8:	8b 55 08             	mov    0x8(%ebp),%edx
+     eeb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     eef:	3c 0a                	cmp    $0xa,%al
+     ef1:	74 10                	je     f03 <gets+0x43>
+     ef3:	3c 0d                	cmp    $0xd,%al
+     ef5:	74 0c                	je     f03 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     ef7:	89 df                	mov    %ebx,%edi
+     ef9:	83 c3 01             	add    $0x1,%ebx
+     efc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     eff:	7c cf                	jl     ed0 <gets+0x10>
+     f01:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     f03:	8b 45 08             	mov    0x8(%ebp),%eax
+     f06:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     f0a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f0d:	5b                   	pop    %ebx
+     f0e:	5e                   	pop    %esi
+     f0f:	5f                   	pop    %edi
+     f10:	5d                   	pop    %ebp
+     f11:	c3                   	ret
+     f12:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000f20 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     f20:	55                   	push   %ebp
+     f21:	89 e5                	mov    %esp,%ebp
+     f23:	56                   	push   %esi
+     f24:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     f25:	83 ec 08             	sub    $0x8,%esp
+     f28:	6a 00                	push   $0x0
+     f2a:	ff 75 08             	push   0x8(%ebp)
+     f2d:	e8 f1 00 00 00       	call   1023 <open>
+  if(fd < 0)
+     f32:	83 c4 10             	add    $0x10,%esp
+     f35:	85 c0                	test   %eax,%eax
+     f37:	78 27                	js     f60 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     f39:	83 ec 08             	sub    $0x8,%esp
+     f3c:	ff 75 0c             	push   0xc(%ebp)
+     f3f:	89 c3                	mov    %eax,%ebx
+     f41:	50                   	push   %eax
+     f42:	e8 f4 00 00 00       	call   103b <fstat>
+  close(fd);
+     f47:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     f4a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     f4c:	e8 ba 00 00 00       	call   100b <close>
+  return r;
+     f51:	83 c4 10             	add    $0x10,%esp
+}
+     f54:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f57:	89 f0                	mov    %esi,%eax
+     f59:	5b                   	pop    %ebx
+     f5a:	5e                   	pop    %esi
+     f5b:	5d                   	pop    %ebp
+     f5c:	c3                   	ret
+     f5d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     f60:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     f65:	eb ed                	jmp    f54 <stat+0x34>
+     f67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f6e:	66 90                	xchg   %ax,%ax
+
+00000f70 <atoi>:
+
+int
+atoi(const char *s)
+{
+     f70:	55                   	push   %ebp
+     f71:	89 e5                	mov    %esp,%ebp
+     f73:	53                   	push   %ebx
+     f74:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     f77:	0f be 02             	movsbl (%edx),%eax
+     f7a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     f7d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     f80:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     f85:	77 1e                	ja     fa5 <atoi+0x35>
+     f87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f8e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     f90:	83 c2 01             	add    $0x1,%edx
+     f93:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     f96:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     f9a:	0f be 02             	movsbl (%edx),%eax
+     f9d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     fa0:	80 fb 09             	cmp    $0x9,%bl
+     fa3:	76 eb                	jbe    f90 <atoi+0x20>
+  return n;
+}
+     fa5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     fa8:	89 c8                	mov    %ecx,%eax
+     faa:	c9                   	leave
+     fab:	c3                   	ret
+     fac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000fb0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     fb0:	55                   	push   %ebp
+     fb1:	89 e5                	mov    %esp,%ebp
+     fb3:	57                   	push   %edi
+     fb4:	56                   	push   %esi
+     fb5:	8b 45 10             	mov    0x10(%ebp),%eax
+     fb8:	8b 55 08             	mov    0x8(%ebp),%edx
+     fbb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     fbe:	85 c0                	test   %eax,%eax
+     fc0:	7e 13                	jle    fd5 <memmove+0x25>
+     fc2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     fc4:	89 d7                	mov    %edx,%edi
+     fc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fcd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     fd0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     fd1:	39 f8                	cmp    %edi,%eax
+     fd3:	75 fb                	jne    fd0 <memmove+0x20>
+  return vdst;
+}
+     fd5:	5e                   	pop    %esi
+     fd6:	89 d0                	mov    %edx,%eax
+     fd8:	5f                   	pop    %edi
+     fd9:	5d                   	pop    %ebp
+     fda:	c3                   	ret
+
+00000fdb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     fdb:	b8 01 00 00 00       	mov    $0x1,%eax
+     fe0:	cd 40                	int    $0x40
+     fe2:	c3                   	ret
+
+00000fe3 <exit>:
+SYSCALL(exit)
+     fe3:	b8 02 00 00 00       	mov    $0x2,%eax
+     fe8:	cd 40                	int    $0x40
+     fea:	c3                   	ret
+
+00000feb <wait>:
+SYSCALL(wait)
+     feb:	b8 03 00 00 00       	mov    $0x3,%eax
+     ff0:	cd 40                	int    $0x40
+     ff2:	c3                   	ret
+
+00000ff3 <pipe>:
+SYSCALL(pipe)
+     ff3:	b8 04 00 00 00       	mov    $0x4,%eax
+     ff8:	cd 40                	int    $0x40
+     ffa:	c3                   	ret
+
+00000ffb <read>:
+SYSCALL(read)
+     ffb:	b8 05 00 00 00       	mov    $0x5,%eax
+    1000:	cd 40                	int    $0x40
+    1002:	c3                   	ret
+
+00001003 <write>:
+SYSCALL(write)
+    1003:	b8 10 00 00 00       	mov    $0x10,%eax
+    1008:	cd 40                	int    $0x40
+    100a:	c3                   	ret
+
+0000100b <close>:
+SYSCALL(close)
+    100b:	b8 15 00 00 00       	mov    $0x15,%eax
+    1010:	cd 40                	int    $0x40
+    1012:	c3                   	ret
+
+00001013 <kill>:
+SYSCALL(kill)
+    1013:	b8 06 00 00 00       	mov    $0x6,%eax
+    1018:	cd 40                	int    $0x40
+    101a:	c3                   	ret
+
+0000101b <exec>:
+SYSCALL(exec)
+    101b:	b8 07 00 00 00       	mov    $0x7,%eax
+    1020:	cd 40                	int    $0x40
+    1022:	c3                   	ret
+
+00001023 <open>:
+SYSCALL(open)
+    1023:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1028:	cd 40                	int    $0x40
+    102a:	c3                   	ret
+
+0000102b <mknod>:
+SYSCALL(mknod)
+    102b:	b8 11 00 00 00       	mov    $0x11,%eax
+    1030:	cd 40                	int    $0x40
+    1032:	c3                   	ret
+
+00001033 <unlink>:
+SYSCALL(unlink)
+    1033:	b8 12 00 00 00       	mov    $0x12,%eax
+    1038:	cd 40                	int    $0x40
+    103a:	c3                   	ret
+
+0000103b <fstat>:
+SYSCALL(fstat)
+    103b:	b8 08 00 00 00       	mov    $0x8,%eax
+    1040:	cd 40                	int    $0x40
+    1042:	c3                   	ret
+
+00001043 <link>:
+SYSCALL(link)
+    1043:	b8 13 00 00 00       	mov    $0x13,%eax
+    1048:	cd 40                	int    $0x40
+    104a:	c3                   	ret
+
+0000104b <mkdir>:
+SYSCALL(mkdir)
+    104b:	b8 14 00 00 00       	mov    $0x14,%eax
+    1050:	cd 40                	int    $0x40
+    1052:	c3                   	ret
+
+00001053 <chdir>:
+SYSCALL(chdir)
+    1053:	b8 09 00 00 00       	mov    $0x9,%eax
+    1058:	cd 40                	int    $0x40
+    105a:	c3                   	ret
+
+0000105b <dup>:
+SYSCALL(dup)
+    105b:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1060:	cd 40                	int    $0x40
+    1062:	c3                   	ret
+
+00001063 <getpid>:
+SYSCALL(getpid)
+    1063:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1068:	cd 40                	int    $0x40
+    106a:	c3                   	ret
+
+0000106b <sbrk>:
+SYSCALL(sbrk)
+    106b:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1070:	cd 40                	int    $0x40
+    1072:	c3                   	ret
+
+00001073 <sleep>:
+SYSCALL(sleep)
+    1073:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1078:	cd 40                	int    $0x40
+    107a:	c3                   	ret
+
+0000107b <uptime>:
+SYSCALL(uptime)
+    107b:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1080:	cd 40                	int    $0x40
+    1082:	c3                   	ret
+
+00001083 <sync>:
+SYSCALL(sync)
+    1083:	b8 16 00 00 00       	mov    $0x16,%eax
+    1088:	cd 40                	int    $0x40
+    108a:	c3                   	ret
+
+0000108b <fsync>:
+SYSCALL(fsync)
+    108b:	b8 17 00 00 00       	mov    $0x17,%eax
+    1090:	cd 40                	int    $0x40
+    1092:	c3                   	ret
+    1093:	66 90                	xchg   %ax,%ax
+    1095:	66 90                	xchg   %ax,%ax
+    1097:	66 90                	xchg   %ax,%ax
+    1099:	66 90                	xchg   %ax,%ax
+    109b:	66 90                	xchg   %ax,%ax
+    109d:	66 90                	xchg   %ax,%ax
+    109f:	90                   	nop
+
+000010a0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    10a0:	55                   	push   %ebp
+    10a1:	89 e5                	mov    %esp,%ebp
+    10a3:	57                   	push   %edi
+    10a4:	56                   	push   %esi
+    10a5:	53                   	push   %ebx
+    10a6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    10a8:	89 d1                	mov    %edx,%ecx
+{
+    10aa:	83 ec 3c             	sub    $0x3c,%esp
+    10ad:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    10b0:	85 d2                	test   %edx,%edx
+    10b2:	0f 89 80 00 00 00    	jns    1138 <printint+0x98>
+    10b8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    10bc:	74 7a                	je     1138 <printint+0x98>
+    x = -xx;
+    10be:	f7 d9                	neg    %ecx
+    neg = 1;
+    10c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    10c5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    10c8:	31 f6                	xor    %esi,%esi
+    10ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    10d0:	89 c8                	mov    %ecx,%eax
+    10d2:	31 d2                	xor    %edx,%edx
+    10d4:	89 f7                	mov    %esi,%edi
+    10d6:	f7 f3                	div    %ebx
+    10d8:	8d 76 01             	lea    0x1(%esi),%esi
+    10db:	0f b6 92 40 19 00 00 	movzbl 0x1940(%edx),%edx
+    10e2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    10e6:	89 ca                	mov    %ecx,%edx
+    10e8:	89 c1                	mov    %eax,%ecx
+    10ea:	39 da                	cmp    %ebx,%edx
+    10ec:	73 e2                	jae    10d0 <printint+0x30>
+  if(neg)
+    10ee:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    10f1:	85 c0                	test   %eax,%eax
+    10f3:	74 07                	je     10fc <printint+0x5c>
+    buf[i++] = '-';
+    10f5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    10fa:	89 f7                	mov    %esi,%edi
+    10fc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    10ff:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    1102:	01 df                	add    %ebx,%edi
+    1104:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    1108:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    110b:	83 ec 04             	sub    $0x4,%esp
+    110e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    1111:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    1114:	6a 01                	push   $0x1
+    1116:	50                   	push   %eax
+    1117:	56                   	push   %esi
+    1118:	e8 e6 fe ff ff       	call   1003 <write>
+  while(--i >= 0)
+    111d:	89 f8                	mov    %edi,%eax
+    111f:	83 c4 10             	add    $0x10,%esp
+    1122:	83 ef 01             	sub    $0x1,%edi
+    1125:	39 d8                	cmp    %ebx,%eax
+    1127:	75 df                	jne    1108 <printint+0x68>
+}
+    1129:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    112c:	5b                   	pop    %ebx
+    112d:	5e                   	pop    %esi
+    112e:	5f                   	pop    %edi
+    112f:	5d                   	pop    %ebp
+    1130:	c3                   	ret
+    1131:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1138:	31 c0                	xor    %eax,%eax
+    113a:	eb 89                	jmp    10c5 <printint+0x25>
+    113c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001140 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1140:	55                   	push   %ebp
+    1141:	89 e5                	mov    %esp,%ebp
+    1143:	57                   	push   %edi
+    1144:	56                   	push   %esi
+    1145:	53                   	push   %ebx
+    1146:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    1149:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    114c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    114f:	0f b6 1e             	movzbl (%esi),%ebx
+    1152:	83 c6 01             	add    $0x1,%esi
+    1155:	84 db                	test   %bl,%bl
+    1157:	74 67                	je     11c0 <printf+0x80>
+    1159:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    115c:	31 d2                	xor    %edx,%edx
+    115e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    1161:	eb 34                	jmp    1197 <printf+0x57>
+    1163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1167:	90                   	nop
+    1168:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    116b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    1170:	83 f8 25             	cmp    $0x25,%eax
+    1173:	74 18                	je     118d <printf+0x4d>
+  write(fd, &c, 1);
+    1175:	83 ec 04             	sub    $0x4,%esp
+    1178:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    117b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    117e:	6a 01                	push   $0x1
+    1180:	50                   	push   %eax
+    1181:	57                   	push   %edi
+    1182:	e8 7c fe ff ff       	call   1003 <write>
+    1187:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    118a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    118d:	0f b6 1e             	movzbl (%esi),%ebx
+    1190:	83 c6 01             	add    $0x1,%esi
+    1193:	84 db                	test   %bl,%bl
+    1195:	74 29                	je     11c0 <printf+0x80>
+    c = fmt[i] & 0xff;
+    1197:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    119a:	85 d2                	test   %edx,%edx
+    119c:	74 ca                	je     1168 <printf+0x28>
+      }
+    } else if(state == '%'){
+    119e:	83 fa 25             	cmp    $0x25,%edx
+    11a1:	75 ea                	jne    118d <printf+0x4d>
+      if(c == 'd'){
+    11a3:	83 f8 25             	cmp    $0x25,%eax
+    11a6:	0f 84 24 01 00 00    	je     12d0 <printf+0x190>
+    11ac:	83 e8 63             	sub    $0x63,%eax
+    11af:	83 f8 15             	cmp    $0x15,%eax
+    11b2:	77 1c                	ja     11d0 <printf+0x90>
+    11b4:	ff 24 85 e8 18 00 00 	jmp    *0x18e8(,%eax,4)
+    11bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    11bf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    11c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    11c3:	5b                   	pop    %ebx
+    11c4:	5e                   	pop    %esi
+    11c5:	5f                   	pop    %edi
+    11c6:	5d                   	pop    %ebp
+    11c7:	c3                   	ret
+    11c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11cf:	90                   	nop
+  write(fd, &c, 1);
+    11d0:	83 ec 04             	sub    $0x4,%esp
+    11d3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    11d6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    11da:	6a 01                	push   $0x1
+    11dc:	52                   	push   %edx
+    11dd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    11e0:	57                   	push   %edi
+    11e1:	e8 1d fe ff ff       	call   1003 <write>
+    11e6:	83 c4 0c             	add    $0xc,%esp
+    11e9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    11ec:	6a 01                	push   $0x1
+    11ee:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    11f1:	52                   	push   %edx
+    11f2:	57                   	push   %edi
+    11f3:	e8 0b fe ff ff       	call   1003 <write>
+        putc(fd, c);
+    11f8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    11fb:	31 d2                	xor    %edx,%edx
+    11fd:	eb 8e                	jmp    118d <printf+0x4d>
+    11ff:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    1200:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1203:	83 ec 0c             	sub    $0xc,%esp
+    1206:	b9 10 00 00 00       	mov    $0x10,%ecx
+    120b:	8b 13                	mov    (%ebx),%edx
+    120d:	6a 00                	push   $0x0
+    120f:	89 f8                	mov    %edi,%eax
+        ap++;
+    1211:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    1214:	e8 87 fe ff ff       	call   10a0 <printint>
+        ap++;
+    1219:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    121c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    121f:	31 d2                	xor    %edx,%edx
+    1221:	e9 67 ff ff ff       	jmp    118d <printf+0x4d>
+    1226:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    122d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1230:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1233:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    1235:	83 c0 04             	add    $0x4,%eax
+    1238:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    123b:	85 db                	test   %ebx,%ebx
+    123d:	0f 84 9d 00 00 00    	je     12e0 <printf+0x1a0>
+        while(*s != 0){
+    1243:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    1246:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    1248:	84 c0                	test   %al,%al
+    124a:	0f 84 3d ff ff ff    	je     118d <printf+0x4d>
+    1250:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1253:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1256:	89 de                	mov    %ebx,%esi
+    1258:	89 d3                	mov    %edx,%ebx
+    125a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    1260:	83 ec 04             	sub    $0x4,%esp
+    1263:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    1266:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    1269:	6a 01                	push   $0x1
+    126b:	53                   	push   %ebx
+    126c:	57                   	push   %edi
+    126d:	e8 91 fd ff ff       	call   1003 <write>
+        while(*s != 0){
+    1272:	0f b6 06             	movzbl (%esi),%eax
+    1275:	83 c4 10             	add    $0x10,%esp
+    1278:	84 c0                	test   %al,%al
+    127a:	75 e4                	jne    1260 <printf+0x120>
+      state = 0;
+    127c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    127f:	31 d2                	xor    %edx,%edx
+    1281:	e9 07 ff ff ff       	jmp    118d <printf+0x4d>
+    1286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    128d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    1290:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1293:	83 ec 0c             	sub    $0xc,%esp
+    1296:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    129b:	8b 13                	mov    (%ebx),%edx
+    129d:	6a 01                	push   $0x1
+    129f:	e9 6b ff ff ff       	jmp    120f <printf+0xcf>
+    12a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    12a8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    12ab:	83 ec 04             	sub    $0x4,%esp
+    12ae:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    12b1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    12b3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    12b6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    12b9:	6a 01                	push   $0x1
+    12bb:	52                   	push   %edx
+    12bc:	57                   	push   %edi
+    12bd:	e8 41 fd ff ff       	call   1003 <write>
+        ap++;
+    12c2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    12c5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    12c8:	31 d2                	xor    %edx,%edx
+    12ca:	e9 be fe ff ff       	jmp    118d <printf+0x4d>
+    12cf:	90                   	nop
+  write(fd, &c, 1);
+    12d0:	83 ec 04             	sub    $0x4,%esp
+    12d3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    12d6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    12d9:	6a 01                	push   $0x1
+    12db:	e9 11 ff ff ff       	jmp    11f1 <printf+0xb1>
+    12e0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    12e5:	bb df 18 00 00       	mov    $0x18df,%ebx
+    12ea:	e9 61 ff ff ff       	jmp    1250 <printf+0x110>
+    12ef:	90                   	nop
+
+000012f0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    12f0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    12f1:	a1 60 25 00 00       	mov    0x2560,%eax
+{
+    12f6:	89 e5                	mov    %esp,%ebp
+    12f8:	57                   	push   %edi
+    12f9:	56                   	push   %esi
+    12fa:	53                   	push   %ebx
+    12fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    12fe:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1301:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1308:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    130a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    130c:	39 ca                	cmp    %ecx,%edx
+    130e:	73 30                	jae    1340 <free+0x50>
+    1310:	39 c1                	cmp    %eax,%ecx
+    1312:	72 04                	jb     1318 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1314:	39 c2                	cmp    %eax,%edx
+    1316:	72 f0                	jb     1308 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1318:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    131b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    131e:	39 f8                	cmp    %edi,%eax
+    1320:	74 2e                	je     1350 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1322:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    1325:	8b 42 04             	mov    0x4(%edx),%eax
+    1328:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    132b:	39 f1                	cmp    %esi,%ecx
+    132d:	74 38                	je     1367 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    132f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1331:	5b                   	pop    %ebx
+  freep = p;
+    1332:	89 15 60 25 00 00    	mov    %edx,0x2560
+}
+    1338:	5e                   	pop    %esi
+    1339:	5f                   	pop    %edi
+    133a:	5d                   	pop    %ebp
+    133b:	c3                   	ret
+    133c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1340:	39 c1                	cmp    %eax,%ecx
+    1342:	72 d0                	jb     1314 <free+0x24>
+    1344:	eb c2                	jmp    1308 <free+0x18>
+    1346:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    134d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1350:	03 70 04             	add    0x4(%eax),%esi
+    1353:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1356:	8b 02                	mov    (%edx),%eax
+    1358:	8b 00                	mov    (%eax),%eax
+    135a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    135d:	8b 42 04             	mov    0x4(%edx),%eax
+    1360:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1363:	39 f1                	cmp    %esi,%ecx
+    1365:	75 c8                	jne    132f <free+0x3f>
+    p->s.size += bp->s.size;
+    1367:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    136a:	89 15 60 25 00 00    	mov    %edx,0x2560
+    p->s.size += bp->s.size;
+    1370:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1373:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1376:	89 0a                	mov    %ecx,(%edx)
+}
+    1378:	5b                   	pop    %ebx
+    1379:	5e                   	pop    %esi
+    137a:	5f                   	pop    %edi
+    137b:	5d                   	pop    %ebp
+    137c:	c3                   	ret
+    137d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001380 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1380:	55                   	push   %ebp
+    1381:	89 e5                	mov    %esp,%ebp
+    1383:	57                   	push   %edi
+    1384:	56                   	push   %esi
+    1385:	53                   	push   %ebx
+    1386:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1389:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    138c:	8b 15 60 25 00 00    	mov    0x2560,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1392:	8d 78 07             	lea    0x7(%eax),%edi
+    1395:	c1 ef 03             	shr    $0x3,%edi
+    1398:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    139b:	85 d2                	test   %edx,%edx
+    139d:	0f 84 8d 00 00 00    	je     1430 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    13a3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    13a5:	8b 48 04             	mov    0x4(%eax),%ecx
+    13a8:	39 f9                	cmp    %edi,%ecx
+    13aa:	73 64                	jae    1410 <malloc+0x90>
+  if(nu < 4096)
+    13ac:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    13b1:	39 df                	cmp    %ebx,%edi
+    13b3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    13b6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    13bd:	eb 0a                	jmp    13c9 <malloc+0x49>
+    13bf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    13c0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    13c2:	8b 48 04             	mov    0x4(%eax),%ecx
+    13c5:	39 f9                	cmp    %edi,%ecx
+    13c7:	73 47                	jae    1410 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    13c9:	89 c2                	mov    %eax,%edx
+    13cb:	39 05 60 25 00 00    	cmp    %eax,0x2560
+    13d1:	75 ed                	jne    13c0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    13d3:	83 ec 0c             	sub    $0xc,%esp
+    13d6:	56                   	push   %esi
+    13d7:	e8 8f fc ff ff       	call   106b <sbrk>
+  if(p == (char*)-1)
+    13dc:	83 c4 10             	add    $0x10,%esp
+    13df:	83 f8 ff             	cmp    $0xffffffff,%eax
+    13e2:	74 1c                	je     1400 <malloc+0x80>
+  hp->s.size = nu;
+    13e4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    13e7:	83 ec 0c             	sub    $0xc,%esp
+    13ea:	83 c0 08             	add    $0x8,%eax
+    13ed:	50                   	push   %eax
+    13ee:	e8 fd fe ff ff       	call   12f0 <free>
+  return freep;
+    13f3:	8b 15 60 25 00 00    	mov    0x2560,%edx
+      if((p = morecore(nunits)) == 0)
+    13f9:	83 c4 10             	add    $0x10,%esp
+    13fc:	85 d2                	test   %edx,%edx
+    13fe:	75 c0                	jne    13c0 <malloc+0x40>
+        return 0;
+  }
+}
+    1400:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1403:	31 c0                	xor    %eax,%eax
+}
+    1405:	5b                   	pop    %ebx
+    1406:	5e                   	pop    %esi
+    1407:	5f                   	pop    %edi
+    1408:	5d                   	pop    %ebp
+    1409:	c3                   	ret
+    140a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1410:	39 cf                	cmp    %ecx,%edi
+    1412:	74 4c                	je     1460 <malloc+0xe0>
+        p->s.size -= nunits;
+    1414:	29 f9                	sub    %edi,%ecx
+    1416:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    1419:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    141c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    141f:	89 15 60 25 00 00    	mov    %edx,0x2560
+}
+    1425:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1428:	83 c0 08             	add    $0x8,%eax
+}
+    142b:	5b                   	pop    %ebx
+    142c:	5e                   	pop    %esi
+    142d:	5f                   	pop    %edi
+    142e:	5d                   	pop    %ebp
+    142f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1430:	c7 05 60 25 00 00 64 	movl   $0x2564,0x2560
+    1437:	25 00 00 
+    base.s.size = 0;
+    143a:	b8 64 25 00 00       	mov    $0x2564,%eax
+    base.s.ptr = freep = prevp = &base;
+    143f:	c7 05 64 25 00 00 64 	movl   $0x2564,0x2564
+    1446:	25 00 00 
+    base.s.size = 0;
+    1449:	c7 05 68 25 00 00 00 	movl   $0x0,0x2568
+    1450:	00 00 00 
+    if(p->s.size >= nunits){
+    1453:	e9 54 ff ff ff       	jmp    13ac <malloc+0x2c>
+    1458:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    145f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1460:	8b 08                	mov    (%eax),%ecx
+    1462:	89 0a                	mov    %ecx,(%edx)
+    1464:	eb b9                	jmp    141f <malloc+0x9f>
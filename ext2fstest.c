@@ -75,6 +75,57 @@ balloctest(void)
   printf(1, "balloc test passed\n");
 }
 
+// Write delayed blocks, push them out with fsync and sync,
+// and check that what reads back afterwards is what was
+// written.  This shows the write-back path keeps the data
+// intact; from inside xv6 it cannot show the disk has it.
+void
+synctest(void)
+{
+  int fd, i, j;
+  char chunk[10];
+
+  printf(1, "ext2 sync test\n");
+
+  fd = open("/mnt/file2", O_CREATE|O_RDWR);
+  if (fd < 0){
+    printf(1, "open in ext2 failed\n");
+    exit();
+  }
+  for (i = 0; i < 100; i++){
+    memset(chunk, 'a' + i % 26, sizeof(chunk));
+    if (write(fd, chunk, sizeof(chunk)) != sizeof(chunk)){
+      printf(1, "write failed\n");
+      exit();
+    }
+  }
+  if (fsync(fd) < 0){
+    printf(1, "fsync failed\n");
+    exit();
+  }
+  close(fd);
+  if (sync() < 0){
+    printf(1, "sync failed\n");
+    exit();
+  }
+
+  fd = open("/mnt/file2", O_RDONLY);
+  if (fd < 0 || read(fd, buf, 1000) != 1000){
+    printf(1, "read back failed\n");
+    exit();
+  }
+  close(fd);
+  for (i = 0; i < 100; i++){
+    for (j = 0; j < 10; j++){
+      if (buf[i * 10 + j] != 'a' + i % 26){
+        printf(1, "wrong data at %d after sync\n", i * 10 + j);
+        exit();
+      }
+    }
+  }
+  printf(1, "sync test passed\n");
+}
+
 void
 createtest(void)
 {
@@ -100,6 +151,233 @@ dirlookuptest(void)
   printf(1, "dirlookuptest passed\n");
 }
 
+// Many small names should share directory blocks, and names
+// removed should leave room for new ones.
+void
+dirlinktest(void)
+{
+  char name[32];
+  struct stat st;
+  int i, fd, size;
+
+  printf(1, "ext2 dirlink test\n");
+  if (mkdir("/mnt/dlt") < 0){
+    printf(1, "mkdir in ext2 failed\n");
+    exit();
+  }
+  strcpy(name, "/mnt/dlt/f00");
+  for (i = 0; i < 100; i++){
+    name[10] = '0' + i / 10;
+    name[11] = '0' + i % 10;
+    if ((fd = open(name, O_CREATE|O_RDWR)) < 0){
+      printf(1, "create %s failed\n", name);
+      exit();
+    }
+    close(fd);
+  }
+  if (stat("/mnt/dlt", &st) < 0 || st.size > 4 * 1024){
+    printf(1, "directory too big: %d\n", st.size);
+    exit();
+  }
+  size = st.size;
+
+  for (i = 0; i < 100; i += 2){
+    name[10] = '0' + i / 10;
+    name[11] = '0' + i % 10;
+    if (unlink(name) < 0){
+      printf(1, "unlink %s failed\n", name);
+      exit();
+    }
+  }
+  name[9] = 'g';
+  for (i = 0; i < 100; i += 2){
+    name[10] = '0' + i / 10;
+    name[11] = '0' + i % 10;
+    if ((fd = open(name, O_CREATE|O_RDWR)) < 0){
+      printf(1, "create %s failed\n", name);
+      exit();
+    }
+    close(fd);
+  }
+  if (stat("/mnt/dlt", &st) < 0 || st.size != size){
+    printf(1, "directory grew: %d -> %d\n", size, st.size);
+    exit();
+  }
+  for (i = 0; i < 100; i++){
+    name[9] = i % 2 ? 'f' : 'g';
+    name[10] = '0' + i / 10;
+    name[11] = '0' + i % 10;
+    if ((fd = open(name, O_RDONLY)) < 0){
+      printf(1, "open %s failed\n", name);
+      exit();
+    }
+    close(fd);
+  }
+
+  // Leave nothing behind, so the test can run again on the
+  // same image.
+  if (unlink("/mnt/dlt") == 0){
+    printf(1, "unlinked non-empty directory\n");
+    exit();
+  }
+  for (i = 0; i < 100; i++){
+    name[9] = i % 2 ? 'f' : 'g';
+    name[10] = '0' + i / 10;
+    name[11] = '0' + i % 10;
+    if (unlink(name) < 0){
+      printf(1, "unlink %s failed\n", name);
+      exit();
+    }
+  }
+  if (unlink("/mnt/dlt") < 0){
+    printf(1, "unlink empty directory failed\n");
+    exit();
+  }
+  printf(1, "dirlinktest passed\n");
+}
+
+// Create a directory that grows new blocks and an index,
+// sync it, and read it back through its entries: blocks the
+// log wrote must hold the names put in them.
+void
+dirsynctest(void)
+{
+  char name[32];
+  int i, fd, n, off, found;
+  uint ino;
+  ushort reclen;
+  uchar namelen;
+
+  printf(1, "ext2 dir sync test\n");
+  if (mkdir("/mnt/dsync") < 0){
+    printf(1, "mkdir in ext2 failed\n");
+    exit();
+  }
+  strcpy(name, "/mnt/dsync/file00");
+  for (i = 0; i < 80; i++){
+    name[15] = '0' + i / 10;
+    name[16] = '0' + i % 10;
+    if ((fd = open(name, O_CREATE|O_RDWR)) < 0){
+      printf(1, "create %s failed\n", name);
+      exit();
+    }
+    close(fd);
+  }
+  if (sync() < 0){
+    printf(1, "sync failed\n");
+    exit();
+  }
+
+  if ((fd = open("/mnt/dsync", O_RDONLY)) < 0){
+    printf(1, "open directory failed\n");
+    exit();
+  }
+  found = 0;
+  while ((n = read(fd, buf, 1024)) == 1024){
+    for (off = 0; off < 1024; off += reclen){
+      memmove(&ino, buf + off, 4);
+      memmove(&reclen, buf + off + 4, 2);
+      namelen = buf[off + 6];
+      if (reclen < 12 || off + reclen > 1024){
+        printf(1, "bad directory block after sync\n");
+        exit();
+      }
+      if (ino != 0 && namelen == 6 && buf[off + 8] == 'f' && buf[off + 11] == 'e')
+        found++;
+    }
+  }
+  close(fd);
+  if (n != 0 || found != 80){
+    printf(1, "found %d of 80 names after sync\n", found);
+    exit();
+  }
+
+  for (i = 0; i < 80; i++){
+    name[15] = '0' + i / 10;
+    name[16] = '0' + i % 10;
+    if (unlink(name) < 0){
+      printf(1, "unlink %s failed\n", name);
+      exit();
+    }
+  }
+  if (unlink("/mnt/dsync") < 0){
+    printf(1, "unlink directory failed\n");
+    exit();
+  }
+  printf(1, "dirsynctest passed\n");
+}
+
+#define NHTREE 5000  // enough names to fill an HTree root
+
+// Set the last element of name, /mnt/htree/hNNNNNabcdefg, for i.
+// Names stay under DIRSIZ bytes, the size of the kernel's
+// buffer for the last element of a path.
+static void
+htreename(char *name, int i)
+{
+  int j;
+
+  strcpy(name, "/mnt/htree/h00000abcdefg");
+  for (j = 16; j > 11; j--, i /= 10)
+    name[j] = '0' + i % 10;
+}
+
+// Enough names in one directory to split leaves until the
+// index root is full and has to grow a level, then find and
+// remove every one of them.
+void
+htreetest(void)
+{
+  char name[32];
+  struct stat st;
+  int i, fd;
+
+  printf(1, "ext2 htree test\n");
+  if (mkdir("/mnt/htree") < 0 ||
+      (fd = open("/mnt/htree/target", O_CREATE|O_RDWR)) < 0){
+    printf(1, "htree setup failed\n");
+    exit();
+  }
+  close(fd);
+  for (i = 0; i < NHTREE; i++){
+    htreename(name, i);
+    if (link("/mnt/htree/target", name) < 0){
+      printf(1, "link %s failed\n", name);
+      exit();
+    }
+  }
+  // More leaves than the 124 entries the root holds.
+  if (stat("/mnt/htree", &st) < 0 || st.size <= 125 * 1024){
+    printf(1, "htree directory too small: %d\n", st.size);
+    exit();
+  }
+  for (i = 0; i < NHTREE; i++){
+    htreename(name, i);
+    if ((fd = open(name, O_RDONLY)) < 0){
+      printf(1, "open %s failed\n", name);
+      exit();
+    }
+    close(fd);
+  }
+  htreename(name, NHTREE);
+  if ((fd = open(name, O_RDONLY)) >= 0){
+    printf(1, "open %s succeeded\n", name);
+    exit();
+  }
+  for (i = 0; i < NHTREE; i++){
+    htreename(name, i);
+    if (unlink(name) < 0){
+      printf(1, "unlink %s failed\n", name);
+      exit();
+    }
+  }
+  if (unlink("/mnt/htree/target") < 0 || unlink("/mnt/htree") < 0){
+    printf(1, "htree cleanup failed\n");
+    exit();
+  }
+  printf(1, "htreetest passed\n");
+}
+
 int
 main(void)
 {
@@ -107,6 +385,10 @@ main(void)
   opentest();
   writetest();
   balloctest();
+  synctest();
   dirlookuptest();
+  dirlinktest();
+  dirsynctest();
+  htreetest();
   exit();
 }
@@ -6,6 +6,7 @@
 #include "defs.h"
 #include "param.h"
 #include "fs.h"
+#include "ext2fs.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "file.h"
@@ -32,6 +33,7 @@ filealloc(void)
   for(f = ftable.file; f < ftable.file + NFILE; f++){
     if(f->ref == 0){
       f->ref = 1;
+      f->ranext = f->rawin = f->raend = 0;
       release(&ftable.lock);
       return f;
     }
@@ -92,6 +94,37 @@ filestat(struct file *f, struct stat *st)
   return -1;
 }
 
+// Sequential read-ahead, after a read of n bytes at off.
+// A read that starts where the last one ended doubles the
+// window, up to RAMAX blocks; any other read closes it.
+// Blocks in the window that have not been asked for yet are
+// read into the buffer cache in the background, so a
+// streaming reader waits on the disk's bandwidth rather
+// than on a round trip per block.  Caller holds f->ip->lock.
+static void
+filereadahead(struct file *f, uint off, uint n)
+{
+  uint start, end;
+
+  if(f->ip->iops->readahead == 0)
+    return;
+  if(off != f->ranext){
+    f->rawin = 0;
+    f->raend = 0;
+  } else if(f->rawin < RAMAX)
+    f->rawin = f->rawin ? f->rawin*2 : RAMIN;
+  f->ranext = off + n;
+  if(f->rawin == 0)
+    return;
+
+  start = f->raend > off + n ? f->raend : off + n;
+  end = off + n + f->rawin*BSIZE;
+  if(start < end){
+    f->ip->iops->readahead(f->ip, start, end - start);
+    f->raend = end;
+  }
+}
+
 // Read from file f.
 int
 fileread(struct file *f, char *addr, int n)
@@ -104,8 +137,10 @@ fileread(struct file *f, char *addr, int n)
     return piperead(f->pipe, addr, n);
   if(f->type == FD_INODE){
     f->ip->iops->ilock(f->ip);
-    if((r = f->ip->iops->readi(f->ip, addr, f->off, n)) > 0)
+    if((r = f->ip->iops->readi(f->ip, addr, f->off, n)) > 0){
+      filereadahead(f, f->off, r);
       f->off += r;
+    }
     f->ip->iops->iunlock(f->ip);
     return r;
   }
@@ -130,7 +165,12 @@ filewrite(struct file *f, char *addr, int n)
     // and 2 blocks of slop for non-aligned writes.
     // this really belongs lower down, since writei()
     // might be writing a device like the console.
-    int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
+    // ext2 logs only metadata, so it can take much larger
+    // pieces; ext2fs.h checks that EXT2_MAXOPBLOCKS has room
+    // for one.
+    int max = ((log_opblocks(f->ip->dev)-1-1-2) / 2) * 512;
+    if(f->ip->dev != ROOTDEV)
+      max = EXT2_WRITEBLOCKS*BSIZE;
     int i = 0;
     while(i < n){
       int n1 = n - i;
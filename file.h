@@ -6,11 +6,16 @@ struct file {
   struct pipe *pipe;
   struct inode *ip;
   uint off;
+  uint ranext;  // offset where the last read ended
+  uint rawin;   // read-ahead window, in blocks
+  uint raend;   // offset up to which read-ahead was started
 };
 
 struct inode_operations {
 	int             (*dirlink)(struct inode*, char*, uint);
 	struct inode*   (*dirlookup)(struct inode*, char*, uint*);
+	void            (*dirunlink)(struct inode*, uint);
+	int             (*dirempty)(struct inode*);
 	struct inode*   (*ialloc)(uint, short);
 	void            (*iinit)(int dev);
 	void            (*ilock)(struct inode*);
@@ -19,6 +24,7 @@ struct inode_operations {
 	void            (*iunlockput)(struct inode*);
 	void            (*iupdate)(struct inode*);
 	int             (*readi)(struct inode*, char*, uint, uint);
+	void            (*readahead)(struct inode*, uint, uint);
 	void            (*stati)(struct inode*, struct stat*);
 	int             (*writei)(struct inode*, char*, uint, uint);
 };
@@ -38,6 +44,8 @@ struct inode {
   short nlink;
   uint size;
   void *addrs;
+
+  struct inode *next; // hash chain or free list; icache.lock
 };
 
 // table mapping major device number to
@@ -38,6 +38,8 @@ struct icache icache;
 struct inode_operations xv6fs_inode_ops = {
 	xv6fs_dirlink,
 	xv6fs_dirlookup,
+	xv6fs_dirunlink,
+	xv6fs_dirempty,
 	xv6fs_ialloc,
 	xv6fs_iinit,
 	xv6fs_ilock,
@@ -46,12 +48,11 @@ struct inode_operations xv6fs_inode_ops = {
 	xv6fs_iunlockput,
 	xv6fs_iupdate,
 	xv6fs_readi,
+	xv6fs_readahead,
 	xv6fs_stati,
 	xv6fs_writei,
 };
 
-struct xv6fs_addrs xv6fs_addrs[NINODE];
-
 // Read the super block.
 void
 xv6fs_readsb(int dev, struct superblock *sb)
@@ -149,7 +150,13 @@ xv6fs_bfree(int dev, uint b)
 //   the number of in-memory pointers to the entry (open
 //   files and current directories). iget() finds or
 //   creates a cache entry and increments its ref; iput()
-//   decrements ref.
+//   decrements ref.  Referenced entries are hashed on
+//   (dev, inum) so that iget finds them without a scan, and
+//   free ones wait on a free list.  The cache starts with
+//   NINODE entries and grows from kalloc a page at a time
+//   whenever iget finds the free list empty.  Each entry
+//   carries room for either file system's block addresses,
+//   which ip->addrs points to.
 //
 // * Valid: the information (type, size, &c) in an inode
 //   cache entry is only correct when ip->valid is 1.
@@ -180,23 +187,67 @@ xv6fs_bfree(int dev, uint b)
 // multi-step atomic operations.
 //
 // The icache.lock spin-lock protects the allocation of icache
-// entries. Since ip->ref indicates whether an entry is free,
-// and ip->dev and ip->inum indicate which i-node an entry
-// holds, one must hold icache.lock while using any of those fields.
+// entries, the hash chains and the free list. Since ip->ref
+// indicates whether an entry is free, and ip->dev and ip->inum
+// indicate which i-node an entry holds, one must hold
+// icache.lock while using any of those fields.
 //
 // An ip->lock sleep-lock protects all ip-> fields other than ref,
 // dev, and inum.  One must hold ip->lock in order to
 // read or write that inode's ip->valid, ip->size, ip->type, &c.
 
+// An inode cache entry, with room for the block addresses of
+// whichever file system the inode is on.
+struct icentry {
+  struct inode inode;
+  union {
+    struct xv6fs_addrs xv6fs;
+    struct ext2fs_addrs ext2fs;
+  } addrs;
+};
+
+// Entries are allocated a page at a time.
+struct inodepage {
+  struct inodepage *next;
+  struct icentry entry[(PGSIZE - sizeof(void*)) / sizeof(struct icentry)];
+};
+#define EPP NELEM(((struct inodepage*)0)->entry)  // entries per page
+
+static struct inodepage ipool[(NINODE + EPP - 1) / EPP];
+
+// Add the entries of page p to the cache, on the free list.
+// Caller holds icache.lock, or is initializing the cache.
+static void
+iaddpage(struct inodepage *p)
+{
+  struct icentry *e;
+
+  for(e = p->entry; e < p->entry+EPP; e++){
+    initsleeplock(&e->inode.lock, "inode");
+    e->inode.addrs = &e->addrs;
+    e->inode.next = icache.free;
+    icache.free = &e->inode;
+  }
+  p->next = icache.pages;
+  icache.pages = p;
+}
+
+static struct inode**
+ihash(uint dev, uint inum)
+{
+  return &icache.hash[(dev * 31 + inum) % NIHASH];
+}
+
 void
 xv6fs_iinit(int dev)
 {
-  int i = 0;
-  
+  struct inodepage *p;
+
+  if(sizeof(struct inodepage) > PGSIZE)
+    panic("iinit: inodepage");
   initlock(&icache.lock, "icache");
-  for(i = 0; i < NINODE; i++) {
-    initsleeplock(&icache.inode[i].lock, "inode");
-  }
+  for(p = ipool; p < ipool+NELEM(ipool); p++)
+    iaddpage(p);
 
   xv6fs_readsb(dev, &sb);
   cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
@@ -263,55 +314,92 @@ xv6fs_iupdate(struct inode *ip)
 struct inode*
 iget(uint dev, uint inum)
 {
-  struct inode *ip, *empty;
-  int i, j;
+  struct inode *ip, **hp;
+  struct inodepage *p;
 
   acquire(&icache.lock);
 
   // Is the inode already cached?
-  empty = 0;
-  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
-    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
+  hp = ihash(dev, inum);
+  for(ip = *hp; ip != 0; ip = ip->next){
+    if(ip->dev == dev && ip->inum == inum){
       ip->ref++;
       release(&icache.lock);
       return ip;
     }
-    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
-      empty = ip;
   }
 
-  for(i = 0; i < NINODE; i++){
-    if (xv6fs_addrs[i].busy == 0)
-      break;
+  // Recycle an inode cache entry, growing the cache if
+  // none is free.
+  if(icache.free == 0){
+    if((p = (struct inodepage*)kalloc()) == 0)
+      panic("iget: no inodes");
+    memset(p, 0, PGSIZE);
+    iaddpage(p);
+    icache.npages++;
   }
-  for(j = 0; j < NINODE; j++){
-    if (ext2fs_addrs[i].busy == 0)
-      break;
-  }
-
-  // Recycle an inode cache entry.
-  if(empty == 0)
-    panic("iget: no inodes");
+  ip = icache.free;
+  icache.free = ip->next;
 
-  ip = empty;
   ip->dev = dev;
   ip->inum = inum;
   ip->ref = 1;
   ip->valid = 0;
-  if (dev == ROOTDEV) {
+  ip->addrs = &((struct icentry*)ip)->addrs;
+  if (dev == ROOTDEV)
     ip->iops = &xv6fs_inode_ops;
-    ip->addrs = (void *)&xv6fs_addrs[i];
-    xv6fs_addrs[i].busy = 1;
-  } else {
+  else
     ip->iops = &ext2fs_inode_ops;
-    ip->addrs = (void *)&ext2fs_addrs[j];
-    ext2fs_addrs[j].busy = 1;
-  }
+  ip->next = *hp;
+  *hp = ip;
   release(&icache.lock);
 
   return ip;
 }
 
+// Drop a reference to ip, and return the number left.  The
+// last one puts the entry back on the free list.
+int
+idrop(struct inode *ip)
+{
+  struct inode **pp;
+  int r;
+
+  acquire(&icache.lock);
+  r = --ip->ref;
+  if(r == 0){
+    for(pp = ihash(ip->dev, ip->inum); *pp != ip; pp = &(*pp)->next)
+      if(*pp == 0)
+        panic("idrop");
+    *pp = ip->next;
+    ip->next = icache.free;
+    icache.free = ip;
+  }
+  release(&icache.lock);
+  return r;
+}
+
+// Type of inode inum on dev if it is in the cache and has
+// been read from disk, 0 if not.
+short
+icachetype(uint dev, uint inum)
+{
+  struct inode *ip;
+  short type;
+
+  type = 0;
+  acquire(&icache.lock);
+  for(ip = *ihash(dev, inum); ip != 0; ip = ip->next){
+    if(ip->dev == dev && ip->inum == inum){
+      if(ip->valid)
+        type = ip->type;
+      break;
+    }
+  }
+  release(&icache.lock);
+  return type;
+}
+
 // Increment reference count for ip.
 // Returns ip to enable ip = idup(ip1) idiom.
 struct inode*
@@ -375,9 +463,7 @@ xv6fs_iunlock(struct inode *ip)
 void
 xv6fs_iput(struct inode *ip)
 {
-  struct xv6fs_addrs *ad;
   acquiresleep(&ip->lock);
-  ad = (struct xv6fs_addrs *)ip->addrs;
   if(ip->valid && ip->nlink == 0){
     acquire(&icache.lock);
     int r = ip->ref;
@@ -394,13 +480,7 @@ xv6fs_iput(struct inode *ip)
   }
   releasesleep(&ip->lock);
 
-  acquire(&icache.lock);
-  ip->ref--;
-  if (ip->ref == 0){
-    ad->busy = 0;
-    ip->addrs = 0;
-  }
-  release(&icache.lock);
+  idrop(ip);
 }
 
 // Common idiom: unlock, then put.
@@ -531,6 +611,24 @@ xv6fs_readi(struct inode *ip, char *dst, uint off, uint n)
   return n;
 }
 
+// Start reading the blocks holding bytes off..off+n-1 of ip
+// into the buffer cache, without waiting for them.
+// Caller must hold ip->lock.
+void
+xv6fs_readahead(struct inode *ip, uint off, uint n)
+{
+  uint bn, end;
+
+  if(ip->type == T_DEV || off >= ip->size)
+    return;
+  if(off + n > ip->size || off + n < off)
+    n = ip->size - off;
+
+  end = (off + n + BSIZE - 1) / BSIZE;
+  for(bn = off/BSIZE; bn < end; bn++)
+    breada(ip->dev, xv6fs_bmap(ip, bn));
+}
+
 // PAGEBREAK!
 // Write data to inode.
 // Caller must hold ip->lock.
@@ -633,6 +731,33 @@ xv6fs_dirlink(struct inode *dp, char *name, uint inum)
   return 0;
 }
 
+// Remove the directory entry at byte offset off of dp.
+void
+xv6fs_dirunlink(struct inode *dp, uint off)
+{
+  struct dirent de;
+
+  memset(&de, 0, sizeof(de));
+  if(dp->iops->writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+    panic("dirunlink");
+}
+
+// Is the directory dp empty except for "." and ".." ?
+int
+xv6fs_dirempty(struct inode *dp)
+{
+  int off;
+  struct dirent de;
+
+  for(off=2*sizeof(de); off<dp->size; off+=sizeof(de)){
+    if(dp->iops->readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+      panic("dirempty: readi");
+    if(de.inum != 0)
+      return 0;
+  }
+  return 1;
+}
+
 //PAGEBREAK!
 // Paths
 
@@ -680,12 +805,14 @@ skipelem(char *path, char *name, uint dev)
 
 // Look up and return the inode for a path name.
 // If parent != 0, return the inode for the parent and copy the final
-// path element into name, which must have room for DIRSIZ bytes.
+// path element into name, which must have room for EXT2_NAME_LEN bytes.
 // Must be called inside a transaction since it calls iput().
 static struct inode*
 namex(char *path, int nameiparent, char *name)
 {
   struct inode *ip, *next;
+  uint inum;
+
   if (strncmp(path, "/mnt", 4) == 0) {
     ip = iget(EXT2DEV, EXT2INO);
     path += 4;
@@ -706,7 +833,13 @@ namex(char *path, int nameiparent, char *name)
       ip->iops->iunlock(ip);
       return ip;
     }
-    if((next = ip->iops->dirlookup(ip, name, 0)) == 0){
+    if(dcache_lookup(ip, name, &inum))
+      next = inum ? iget(ip->dev, inum) : 0;
+    else {
+      next = ip->iops->dirlookup(ip, name, 0);
+      dcache_enter(ip, name, next ? next->inum : 0);
+    }
+    if(next == 0){
       ip->iops->iunlockput(ip);
       return 0;
     }
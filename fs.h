@@ -19,6 +19,7 @@ struct superblock {
   uint logstart;     // Block number of first log block
   uint inodestart;   // Block number of first inode block
   uint bmapstart;    // Block number of first free map block
+  uint maxop;        // Most blocks one FS operation writes (0: MAXOPBLOCKS)
 };
 
 #define NDIRECT 12
@@ -26,7 +27,6 @@ struct superblock {
 #define MAXFILE (NDIRECT + NINDIRECT)
 
 struct xv6fs_addrs {
-  uint busy;
   uint addrs[NDIRECT + 1];
 };
 
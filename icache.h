@@ -1,5 +1,9 @@
+#define NIHASH 61
+
 struct icache{
   struct spinlock lock;
-  struct inode inode[NINODE];
+  struct inodepage *pages;  // list of all pages, through next
+  int npages;               // pages allocated with kalloc
+  struct inode *free;       // unreferenced entries, through next
+  struct inode *hash[NIHASH];  // referenced entries, through next
 };
-
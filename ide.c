@@ -1,4 +1,6 @@
-// Simple PIO-based (non-DMA) IDE driver code.
+// IDE driver code.  Transfers use PCI bus-master DMA when the
+// IDE controller supports it, so the disk moves the data while
+// the CPU runs other processes, and PIO otherwise.
 
 #include "types.h"
 #include "defs.h"
@@ -18,44 +20,325 @@
 #define IDE_DRDY      0x40
 #define IDE_DF        0x20
 #define IDE_ERR       0x01
+#define IDE_CTL_SRST  0x04  // device control: software reset
+#define IDE_WAITSPIN  1000000  // status reads before giving up
 
 #define IDE_CMD_READ  0x20
 #define IDE_CMD_WRITE 0x30
 #define IDE_CMD_RDMUL 0xc4
 #define IDE_CMD_WRMUL 0xc5
-
-// idequeue points to the buf now being read/written to the disk.
-// idequeue->qnext points to the next buf to be processed.
-// You must hold idelock while manipulating queue.
-
-static struct spinlock idelock;
-static struct buf *idequeue;
+#define IDE_CMD_SETMULT 0xc6
+#define IDE_CMD_READ_DMA  0xc8
+#define IDE_CMD_WRITE_DMA 0xca
+
+// PCI configuration space.
+#define PCI_CONFIG_ADDR 0xcf8
+#define PCI_CONFIG_DATA 0xcfc
+#define PCI_CMD_IO      0x1
+#define PCI_CMD_MASTER  0x4
+
+// Bus-master IDE registers, relative to a channel's bm.  The
+// secondary channel's are 8 past the primary's.
+#define BM_CMD        0
+#define BM_STATUS     2
+#define BM_PRDT       4
+#define BM_CMD_START  0x01
+#define BM_CMD_READ   0x08  // transfer from disk to memory
+#define BM_ST_ACTIVE  0x01
+#define BM_ST_ERR     0x02
+#define BM_ST_INTR    0x04
+
+// Physical region descriptor: one physically contiguous
+// piece of a DMA transfer, which may not cross 64K.
+struct prd {
+  uint addr;
+  ushort len;
+  ushort flags;
+};
+#define PRD_EOT 0x8000  // last entry of the table
+
+// A table per channel.  A buffer takes at most two regions.
+// The tables fit in a page, so page alignment keeps them from
+// crossing 64K.
+static struct prd prdt[2][2*IDEMAXBLOCKS] __attribute__((aligned(PGSIZE)));
+
+// Per-channel counters, shown by idedump.  Times are in units
+// of 1024 CPU cycles (kc).  A request's wait is the time its
+// first buf spent queued, its service time is from when it was
+// sent to the disk to its completion interrupt.
+#define NLATBUCKET 16
+struct idestat {
+  uint nreq;      // requests completed
+  uint nblocks;   // blocks moved
+  uint nerr;      // requests retried after an error
+  uint ntimeout;  // requests retried after a timeout
+  uint waitkc;    // total wait
+  uint svckc;     // total service time
+  uint maxkc;     // longest wait plus service time
+  uint hist[NLATBUCKET];  // wait plus service, by power of 2
+};
+
+// The two ATA channels are independent, so each has its own
+// lock, queue and request in flight, and the root disk on the
+// primary channel never waits for the ext2 disk on the
+// secondary, or the other way around.
+//
+// queue holds the bufs waiting for the channel, linked through
+// qnext, in the order the disk scheduler keeps them.  active
+// holds the bufs of the request in flight: the one the
+// scheduler picked and any queued bufs for the blocks that
+// follow it on disk, moved by one command and completed by
+// one interrupt.
+// You must hold the channel's lock while manipulating either.
+struct idechan {
+  struct spinlock lock;
+  int port;       // command block registers
+  int ctl;        // device control register
+  int bm;         // bus-master registers, or 0 to use PIO
+  int dma;        // the active request is using DMA
+  struct buf *queue;
+  struct buf *active[IDEMAXBLOCKS];
+  int nactive;
+  uint headdev;   // where the last request left the head
+  uint headblock;
+  uint starttick; // when the active request was started
+  uint64 startcyc;
+  int retries;    // of the active request
+  int overdue;    // idetimer found the active request late
+  struct idestat stat;
+};
+
+static struct idechan idechan[2];
+
+// idewatchd sleeps on ideoverdue until idetimer sees a late
+// request.  idewatchlock protects ideoverdue.
+static struct spinlock idewatchlock;
+static int ideoverdue;
+
+// A disk scheduling policy.  insert adds b to c's queue, and
+// next removes and returns the buf to start next.  Both are
+// called with c->lock held.
+struct idesched {
+  char *name;
+  void (*insert)(struct idechan*, struct buf*);
+  struct buf* (*next)(struct idechan*);
+};
+
+static struct idesched *idesched;
 
 static int havedisk1;
 static int havedisk2;
-static void idestart(struct buf*);
+static int idemult[3];  // most blocks per PIO request, per disk
+static void idestart(struct idechan*);
+
+// Disks 0 and 1 are on the primary channel, disk 2 on the
+// secondary.
+static struct idechan*
+idechanof(uint dev)
+{
+  return &idechan[dev <= 1 ? 0 : 1];
+}
+
+// FIFO: serve requests in arrival order.
+static void
+fifoinsert(struct idechan *c, struct buf *b)
+{
+  struct buf **pp;
+
+  b->qnext = 0;
+  for(pp=&c->queue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
+    ;
+  *pp = b;
+}
+
+static struct buf*
+fifonext(struct idechan *c)
+{
+  struct buf *b;
+
+  b = c->queue;
+  c->queue = b->qnext;
+  return b;
+}
+
+// Does b come before block blockno of disk dev?
+static int
+idebefore(struct buf *b, uint dev, uint blockno)
+{
+  return b->dev < dev || (b->dev == dev && b->blockno < blockno);
+}
+
+// C-SCAN: keep the queue sorted by position on disk and sweep
+// the head across it in one direction, then jump back to the
+// start, so a request waits at most one sweep.  A request that
+// has waited IDEDEADLINE ticks anyway is served first.
+static void
+cscaninsert(struct idechan *c, struct buf *b)
+{
+  struct buf **pp;
 
-// Wait for IDE disk to become ready.
+  for(pp=&c->queue; *pp; pp=&(*pp)->qnext)
+    if(idebefore(b, (*pp)->dev, (*pp)->blockno))
+      break;
+  b->qnext = *pp;
+  *pp = b;
+}
+
+static struct buf*
+cscannext(struct idechan *c)
+{
+  struct buf *b, **pp, **next, **old;
+
+  next = old = 0;
+  for(pp=&c->queue; (b = *pp) != 0; pp=&b->qnext){
+    if(next == 0 && !idebefore(b, c->headdev, c->headblock))
+      next = pp;
+    if(old == 0 || b->qtime < (*old)->qtime)
+      old = pp;
+  }
+  if(ticks - (*old)->qtime >= IDEDEADLINE)
+    next = old;
+  else if(next == 0)
+    next = &c->queue;  // wrap around
+
+  b = *next;
+  *next = b->qnext;
+  return b;
+}
+
+static struct idesched idescheds[] = {
+  { "fifo", fifoinsert, fifonext },
+  { "cscan", cscaninsert, cscannext },
+};
+
+// Wait for IDE disk to become ready, but not forever.
+// Returns -1 if it stays busy, or if checkerr and it
+// reports an error.
 static int
 idewait(int checkerr, int portno)
 {
-  int r;
+  int r, i;
 
-  while(((r = inb(portno + 7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
-    ;
+  for(i = 0; ((r = inb(portno + 7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY; i++)
+    if(i >= IDE_WAITSPIN)
+      return -1;
   if(checkerr && (r & (IDE_DF|IDE_ERR)) != 0)
     return -1;
   return 0;
 }
 
+static uint
+pciread(int dev, int func, int off)
+{
+  outl(PCI_CONFIG_ADDR, 0x80000000 | (dev<<11) | (func<<8) | (off&0xfc));
+  return inl(PCI_CONFIG_DATA);
+}
+
+static void
+pciwrite(int dev, int func, int off, uint v)
+{
+  outl(PCI_CONFIG_ADDR, 0x80000000 | (dev<<11) | (func<<8) | (off&0xfc));
+  outl(PCI_CONFIG_DATA, v);
+}
+
+// Look on PCI bus 0 for an IDE controller that can bus-master
+// (PIIX, as QEMU emulates it), and enable it for DMA.  If there
+// is none, the channels' bm stays 0 and the driver uses PIO.
+static void
+idedmainit(void)
+{
+  int dev, func;
+  uint class, bar;
+
+  for(dev = 0; dev < 32; dev++){
+    for(func = 0; func < 8; func++){
+      if((pciread(dev, func, 0) & 0xffff) == 0xffff)
+        continue;
+      class = pciread(dev, func, 8);
+      // Class 1 (mass storage), subclass 1 (IDE), and
+      // programming interface bit 7 (bus master).
+      if((class >> 16) != 0x0101 || (class & 0x8000) == 0)
+        continue;
+      bar = pciread(dev, func, 0x20);
+      if((bar & 1) == 0)
+        continue;
+      pciwrite(dev, func, 4,
+               pciread(dev, func, 4) | PCI_CMD_IO | PCI_CMD_MASTER);
+      idechan[0].bm = bar & ~3;
+      idechan[1].bm = (bar & ~3) + 8;
+      return;
+    }
+  }
+}
+
+// Point c's PRD table at the data of the active bufs.
+// A buffer that straddles a 64K boundary is split in two.
+static struct prd*
+ideprd(struct idechan *c)
+{
+  struct prd *t;
+  uint pa, n;
+  int i;
+
+  t = prdt[c - idechan];
+  for(i = 0; i < c->nactive; i++){
+    pa = V2P(c->active[i]->data);
+    n = 0x10000 - (pa & 0xffff);
+    if(n < BSIZE){
+      t->addr = pa;
+      t->len = n;
+      t->flags = 0;
+      t++;
+      pa += n;
+    } else
+      n = 0;
+    t->addr = pa;
+    t->len = BSIZE - n;
+    t->flags = 0;
+    t++;
+  }
+  t[-1].flags = PRD_EOT;
+  return prdt[c - idechan];
+}
+
+// Ask disk dev to move up to IDEMAXBLOCKS blocks per interrupt
+// in READ/WRITE MULTIPLE, so that a merged PIO request takes
+// one interrupt.  If the disk refuses, it gets one block per
+// request, as before.
+static void
+idesetmult(int dev)
+{
+  int portno = idechanof(dev)->port;
+
+  idewait(0, portno);
+  outb(portno + 6, 0xe0 | ((dev&1)<<4));
+  outb(portno + 2, IDEMAXBLOCKS*BSIZE/SECTOR_SIZE);
+  outb(portno + 7, IDE_CMD_SETMULT);
+  idemult[dev] = (idewait(1, portno) >= 0) ? IDEMAXBLOCKS : 1;
+}
+
 void
 ideinit(void)
 {
   int i;
 
-  initlock(&idelock, "ide");
+  idesched = &idescheds[0];
+  for(i = 0; i < NELEM(idescheds); i++)
+    if(strncmp(idescheds[i].name, IDESCHED, 16) == 0)
+      idesched = &idescheds[i];
+  cprintf("ide: %s scheduling\n", idesched->name);
+  initlock(&idewatchlock, "idewatch");
+
+  initlock(&idechan[0].lock, "ide0");
+  idechan[0].port = 0x1f0;
+  idechan[0].ctl = 0x3f6;
+  initlock(&idechan[1].lock, "ide1");
+  idechan[1].port = 0x170;
+  idechan[1].ctl = 0x376;
+  // Send the channels' interrupts to different CPUs, if there
+  // are two, so that their completions can run in parallel too.
   ioapicenable(IRQ_IDE, ncpu - 1);
-  ioapicenable(IRQ_IDE + 1, ncpu - 1);
+  ioapicenable(IRQ_IDE + 1, ncpu > 1 ? ncpu - 2 : 0);
 
   // Check if disk 1 is present
   outb(0x1f6, 0xe0 | (1<<4));
@@ -75,100 +358,367 @@ ideinit(void)
     }
   }
 
+  idesetmult(0);
+  if(havedisk1)
+    idesetmult(1);
+  if(havedisk2)
+    idesetmult(2);
+
   // Switch back to disk 0.
   outb(0x1f6, 0xe0 | (0<<4));
+
+  idedmainit();
 }
 
-// Start the request for b.  Caller must hold idelock.
+// Reset the drives on channel c, after a failed request.
+// Caller must hold c->lock.
 static void
-idestart(struct buf *b)
+idereset(struct idechan *c)
 {
-  if(b == 0)
-    panic("idestart");
-  if(b->dev == ROOTDEV && b->blockno >= FSSIZE)
+  if(c->bm)
+    outb(c->bm + BM_CMD, 0);
+  outb(c->ctl, IDE_CTL_SRST);
+  microdelay(10);
+  outb(c->ctl, 0);
+  microdelay(2000);
+  idewait(0, c->port);
+}
+
+// Send the request in c->active to the disk.
+// Caller must hold c->lock.
+static void
+ideissue(struct idechan *c)
+{
+  struct buf *b;
+  int i, dirty;
+
+  b = c->active[0];
+  dirty = b->flags & B_DIRTY;
+  c->headdev = b->dev;
+  c->headblock = b->blockno + c->nactive;
+  if(b->dev == ROOTDEV && b->blockno + c->nactive > FSSIZE)
     panic("incorrect xv6 blockno");
-  else if(b->dev == EXT2DEV && b->blockno >= EXT2FSSIZE)
+  else if(b->dev == EXT2DEV && b->blockno + c->nactive > EXT2FSSIZE)
     panic("incorrect ext2 blockno");
 
-  int portno;
-  if (b->dev <= 1)
-     portno = 0x1f0; // primary port
-  else
-     portno = 0x170; // secondary port
-
+  int portno = c->port;
   int sector_per_block =  BSIZE/SECTOR_SIZE;
   int sector = b->blockno * sector_per_block;
-  int read_cmd = (sector_per_block == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
-  int write_cmd = (sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
+  int nsect = c->nactive * sector_per_block;
+  int read_cmd = (nsect == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
+  int write_cmd = (nsect == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
 
-  if (sector_per_block > 7) panic("idestart");
+  if (nsect > 255) panic("idestart");
 
-  idewait(0, portno);
-  if (b->dev <= 1) {
-     outb(0x3f6, 0); // generate interrupt to device 0 and 1
-  } else {
-     outb(0x376, 0); // generate interrupt to device 2
-  }
+  // The channel is idle, so this normally returns at once.
+  // If the disk is stuck, send the command anyway: it will
+  // fail or time out, and be retried after a reset.
+  if(idewait(0, portno) < 0)
+    cprintf("ide%d: disk not ready\n", (int)(c - idechan));
+  outb(c->ctl, 0); // generate interrupt
+
+  c->starttick = ticks;
+  c->startcyc = rdtsc();
 
-  outb(portno + 2, sector_per_block);//number of sectors
+  outb(portno + 2, nsect);//number of sectors
   outb(portno + 3, sector & 0xff);
   outb(portno + 4, (sector >> 8) & 0xff);
   outb(portno + 5, (sector >> 16) & 0xff);
   outb(portno + 6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
 
-  if(b->flags & B_DIRTY){
+  if(c->bm){
+    outl(c->bm + BM_PRDT, V2P(ideprd(c)));
+    outb(c->bm + BM_CMD, dirty ? 0 : BM_CMD_READ);
+    outb(c->bm + BM_STATUS, BM_ST_ERR|BM_ST_INTR);  // write 1 to clear
+    outb(portno + 7, dirty ? IDE_CMD_WRITE_DMA : IDE_CMD_READ_DMA);
+    outb(c->bm + BM_CMD, inb(c->bm + BM_CMD) | BM_CMD_START);
+    c->dma = 1;
+    return;
+  }
+
+  c->dma = 0;
+  if(dirty){
     outb(portno + 7, write_cmd);
-    outsl(portno, b->data, BSIZE/4);
+    for(i = 0; i < c->nactive; i++)
+      outsl(portno, c->active[i]->data, BSIZE/4);
   } else {
     outb(portno + 7, read_cmd);
   }
 }
 
-// Interrupt handler.
-void
-ideintr(int flag)
+// Start a request for the buf the scheduler picks from c's
+// queue, merged with queued bufs for the blocks after it on
+// the same disk going the same way, up to the most one
+// command may carry.  Caller must hold c->lock.
+static void
+idestart(struct idechan *c)
+{
+  struct buf *b, **pp;
+  int max, dirty;
+
+  if(c->queue == 0)
+    panic("idestart");
+  b = idesched->next(c);
+  c->active[0] = b;
+  c->nactive = 1;
+  c->retries = 0;
+
+  dirty = b->flags & B_DIRTY;
+  max = c->bm ? IDEMAXBLOCKS : idemult[b->dev];
+  while(c->nactive < max){
+    for(pp = &c->queue; (b = *pp) != 0; pp = &b->qnext)
+      if(b->dev == c->active[0]->dev && (b->flags & B_DIRTY) == dirty &&
+         b->blockno == c->active[c->nactive-1]->blockno + 1)
+        break;
+    if(b == 0)
+      break;
+    *pp = b->qnext;
+    c->active[c->nactive++] = b;
+  }
+
+  ideissue(c);
+}
+
+// The request in c->active is over: done, or failed if err
+// is set.  A failed buf gets B_ERROR; a read leaves B_VALID
+// clear so the block is read again next time, and a write is
+// lost.  Wakes the processes waiting for the bufs and starts
+// the next request.  Stores the B_ASYNC bufs, which nobody
+// waits for, in done and returns how many there are; the
+// caller must biodone them after releasing c->lock.
+static int
+idefinish(struct idechan *c, int err, struct buf **done)
 {
   struct buf *b;
+  int i, ndone;
+
+  ndone = 0;
+  for(i = 0; i < c->nactive; i++){
+    b = c->active[i];
+    if(err)
+      b->flags |= B_ERROR;
+    else
+      b->flags |= B_VALID;
+    b->flags &= ~B_DIRTY;
+    if(b->flags & B_ASYNC){
+      b->flags &= ~B_ASYNC;
+      done[ndone++] = b;
+    }
+    wakeup(b);
+  }
+  c->nactive = 0;
 
-  int portno;
-  // First queued buffer is the active request.
-  acquire(&idelock);
-  if (flag == 0) // primary bus (device 0 and 1)
-     portno = 0x1f0;
-  else // secondary bus (device 2)
-     portno = 0x170;
+  // Start disk on next buf in queue.
+  if(c->queue != 0)
+    idestart(c);
+  return ndone;
+}
 
-  if((b = idequeue) == 0){
-    release(&idelock);
-    return;
+// The request in flight on c failed or timed out.  Reset the
+// channel and send the request again, up to IDEMAXRETRY times,
+// then give up and fail its bufs.  Returns what idefinish does,
+// or 0 while retrying.  Caller must hold c->lock.
+static int
+ideretry(struct idechan *c, char *why, struct buf **done)
+{
+  cprintf("ide%d: %s, block %d, retry %d\n", (int)(c - idechan), why,
+          c->active[0]->blockno, c->retries + 1);
+  idereset(c);
+  if(++c->retries > IDEMAXRETRY){
+    cprintf("ide%d: giving up on block %d\n", (int)(c - idechan),
+            c->active[0]->blockno);
+    return idefinish(c, 1, done);
   }
-  idequeue = b->qnext;
+  ideissue(c);
+  return 0;
+}
 
-  // Read data if needed.
-  if(!(b->flags & B_DIRTY) && idewait(1, portno) >= 0)
-    insl(portno, b->data, BSIZE/4);
+// Account for the request in c->active, which has completed.
+static void
+idecount(struct idechan *c)
+{
+  struct idestat *st;
+  uint64 now;
+  uint wait, svc, i;
+
+  st = &c->stat;
+  now = rdtsc();
+  wait = (uint)((c->startcyc - c->active[0]->qcyc) >> 10);
+  svc = (uint)((now - c->startcyc) >> 10);
+  st->nreq++;
+  st->nblocks += c->nactive;
+  st->waitkc += wait;
+  st->svckc += svc;
+  if(wait + svc > st->maxkc)
+    st->maxkc = wait + svc;
+  for(i = 0; i < NLATBUCKET-1 && (wait + svc) >> (i+1); i++)
+    ;
+  st->hist[i]++;
+}
 
-  // Wake process waiting for this buf.
-  b->flags |= B_VALID;
-  b->flags &= ~B_DIRTY;
-  wakeup(b);
+// Interrupt handler for channel flag: 0 for the primary bus
+// (devices 0 and 1), 1 for the secondary bus (device 2).
+// The disk raises the interrupt when it is done, so the
+// status is read once, without waiting.
+void
+ideintr(int flag)
+{
+  struct idechan *c;
+  struct buf *done[IDEMAXBLOCKS];
+  int i, ndone, st;
+
+  c = &idechan[flag];
+  // c->active holds the request that has finished.
+  acquire(&c->lock);
+  if(c->nactive == 0){
+    release(&c->lock);
+    return;
+  }
 
-  // Start disk on next buf in queue.
-  if(idequeue != 0)
-    idestart(idequeue);
+  if(c->dma){
+    int bmst = inb(c->bm + BM_STATUS);
+    if((bmst & (BM_ST_ACTIVE|BM_ST_INTR)) == BM_ST_ACTIVE){
+      // Not from this transfer, which is still running.
+      release(&c->lock);
+      return;
+    }
+    outb(c->bm + BM_CMD, 0);
+    outb(c->bm + BM_STATUS, BM_ST_ERR|BM_ST_INTR);
+    st = inb(c->port + 7);
+    if((bmst & BM_ST_ERR) || (st & (IDE_BSY|IDE_DF|IDE_ERR))){
+      // Give up on DMA and redo the request with PIO.
+      cprintf("ide%d: dma error, falling back to pio\n", flag);
+      c->stat.nerr++;
+      c->bm = 0;
+      for(i = 0; i < c->nactive; i++)
+        idesched->insert(c, c->active[i]);
+      idereset(c);
+      idestart(c);
+      release(&c->lock);
+      return;
+    }
+  } else {
+    st = inb(c->port + 7);  // also acknowledges the interrupt
+    if(st & IDE_BSY){
+      // Not from this request, which is still running.
+      release(&c->lock);
+      return;
+    }
+    if(st & (IDE_DF|IDE_ERR)){
+      c->stat.nerr++;
+      ndone = ideretry(c, "error", done);
+      release(&c->lock);
+      for(i = 0; i < ndone; i++)
+        biodone(done[i]);
+      return;
+    }
+    // Read data if needed.
+    if(!(c->active[0]->flags & B_DIRTY))
+      for(i = 0; i < c->nactive; i++)
+        insl(c->port, c->active[i]->data, BSIZE/4);
+  }
+  idecount(c);
+  ndone = idefinish(c, 0, done);
+  release(&c->lock);
+
+  // Nobody is waiting for these; release them for the
+  // processes that queued them.
+  for(i = 0; i < ndone; i++)
+    biodone(done[i]);
+}
 
-  release(&idelock);
+// Called on every clock tick.  Notes a request that has not
+// completed within IDETIMEOUT ticks, for instance because its
+// completion interrupt was lost, and wakes idewatchd to retry
+// it: resetting the channel spins too long for an interrupt.
+void
+idetimer(void)
+{
+  struct idechan *c;
+  int late;
+
+  late = 0;
+  for(c = idechan; c < idechan+NELEM(idechan); c++){
+    acquire(&c->lock);
+    if(c->nactive > 0 && !c->overdue && ticks - c->starttick >= IDETIMEOUT){
+      c->overdue = 1;
+      late = 1;
+    }
+    release(&c->lock);
+  }
+  if(late){
+    acquire(&idewatchlock);
+    ideoverdue = 1;
+    wakeup(&ideoverdue);
+    release(&idewatchlock);
+  }
 }
 
-//PAGEBREAK!
-// Sync buf with disk.
-// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
-// Else if B_VALID is not set, read buf from disk, set B_VALID.
+// The watchdog process.  Retries the requests idetimer found
+// late, if they still have not completed.
 void
-iderw(struct buf *b)
+idewatchd(void)
 {
-  struct buf **pp;
+  struct idechan *c;
+  struct buf *done[IDEMAXBLOCKS];
+  int i, ndone;
+
+  for(;;){
+    acquire(&idewatchlock);
+    while(!ideoverdue)
+      sleep(&ideoverdue, &idewatchlock);
+    ideoverdue = 0;
+    release(&idewatchlock);
+
+    for(c = idechan; c < idechan+NELEM(idechan); c++){
+      ndone = 0;
+      acquire(&c->lock);
+      if(c->overdue){
+        c->overdue = 0;
+        if(c->nactive > 0 && ticks - c->starttick >= IDETIMEOUT){
+          c->stat.ntimeout++;
+          ndone = ideretry(c, "timeout", done);
+        }
+      }
+      release(&c->lock);
+      for(i = 0; i < ndone; i++)
+        biodone(done[i]);
+    }
+  }
+}
 
+// Print the channels' counters on the console.  Runs when
+// the user types ^T.
+void
+idedump(void)
+{
+  struct idechan *c;
+  struct idestat st;
+  int i, n;
+
+  for(c = idechan; c < idechan+NELEM(idechan); c++){
+    acquire(&c->lock);
+    st = c->stat;
+    release(&c->lock);
+    n = st.nreq ? st.nreq : 1;
+    cprintf("ide%d: %d reqs %d blocks %d errs %d timeouts\n",
+            (int)(c - idechan), st.nreq, st.nblocks, st.nerr, st.ntimeout);
+    cprintf("  avg wait %d kc, avg service %d kc, max %d kc\n",
+            st.waitkc / n, st.svckc / n, st.maxkc);
+    cprintf("  latency kc:");
+    for(i = 0; i < NLATBUCKET; i++)
+      if(st.hist[i])
+        cprintf(" <%d:%d", 1 << (i+1), st.hist[i]);
+    cprintf("\n");
+  }
+}
+
+//PAGEBREAK!
+// Add b to its channel's queue, starting the channel if
+// it is idle.  Caller must hold c->lock.
+static void
+ideenqueue(struct idechan *c, struct buf *b)
+{
   if(!holdingsleep(&b->lock))
     panic("iderw: buf not locked");
   if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
@@ -178,23 +728,70 @@ iderw(struct buf *b)
   if(b->dev != 0 && !havedisk2)
     panic("iderw: ide disk 2 not present");
 
-  acquire(&idelock);  //DOC:acquire-lock
-
-  // Append b to idequeue.
+  b->flags &= ~B_ERROR;
   b->qnext = 0;
-  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
-    ;
-  *pp = b;
+  b->qtime = ticks;
+  b->qcyc = rdtsc();
+  idesched->insert(c, b);
 
   // Start disk if necessary.
-  if(idequeue == b)
-    idestart(b);
+  if(c->nactive == 0)
+    idestart(c);
+}
+
+// Has the transfer for b finished, or failed?
+static int
+idedone(struct buf *b)
+{
+  return (b->flags & B_ERROR) || (b->flags & (B_VALID|B_DIRTY)) == B_VALID;
+}
+
+// Sync buf with disk.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+// If the disk fails, set B_ERROR instead.
+void
+iderw(struct buf *b)
+{
+  struct idechan *c = idechanof(b->dev);
+
+  acquire(&c->lock);  //DOC:acquire-lock
+
+  ideenqueue(c, b);
 
   // Wait for request to finish.
-  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
-    sleep(b, &idelock);
+  while(!idedone(b)){
+    sleep(b, &c->lock);
   }
 
 
-  release(&idelock);
+  release(&c->lock);
+}
+
+// Like iderw, but return without waiting.  Normally the caller
+// keeps b locked and waits for the transfer with iderw_wait.
+// If B_ASYNC is set, the caller instead hands over its lock on
+// b and its reference: ideintr releases both when the transfer
+// completes.
+void
+iderw_async(struct buf *b)
+{
+  struct idechan *c = idechanof(b->dev);
+
+  acquire(&c->lock);
+  ideenqueue(c, b);
+  release(&c->lock);
+}
+
+// Wait for a transfer started by iderw_async to finish.
+void
+iderw_wait(struct buf *b)
+{
+  struct idechan *c = idechanof(b->dev);
+
+  acquire(&c->lock);
+  while(!idedone(b)){
+    sleep(b, &c->lock);
+  }
+  release(&c->lock);
 }
@@ -83,7 +83,10 @@ char*
 kalloc(void)
 {
   struct run *r;
+  int retry;
 
+  retry = kmem.use_lock;
+again:
   if(kmem.use_lock)
     acquire(&kmem.lock);
   r = kmem.freelist;
@@ -91,6 +94,12 @@ kalloc(void)
     kmem.freelist = r->next;
   if(kmem.use_lock)
     release(&kmem.lock);
+  // Out of memory: take pages back from the buffer cache.
+  if(r == 0 && retry){
+    retry = 0;
+    if(bshrink() > 0)
+      goto again;
+  }
   return (char*)r;
 }
 
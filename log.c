@@ -1,11 +1,15 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
 
+#define min(a, b) ((a) < (b) ? (a) : (b))
+#define max(a, b) ((a) > (b) ? (a) : (b))
+
 // Simple logging that allows concurrent FS system calls.
 //
 // A log transaction contains the updates of multiple FS system
@@ -20,190 +24,972 @@
 // But if it thinks the log is close to running out, it
 // sleeps until the last outstanding end_op() commits.
 //
+// The last end_op() does not commit right away unless the
+// log is nearly full.  The transaction stays open so that
+// the system calls of the next LOGCOMMITTICKS ticks can join
+// it and share one log write; logcommitd() then marks it
+// due, and the next end_op() to leave it idle commits it.
+// logflush() commits at once, for sync and fsync.
+//
+// Each device with a log has its own struct log, and its
+// own transactions.  A system call does not know in advance
+// which file system it will touch, so begin_op() and end_op()
+// reserve and release space in every log.
+//
 // The log is a physical re-do log containing disk blocks.
-// The on-disk log format:
-//   header block, containing block #s for block A, B, C, ...
+// Where the log lives and how it is laid out depends on the
+// file system; struct logformat hides the difference.
+//
+// Committing a transaction only appends it to the log; the
+// logged blocks stay pinned in the buffer cache, and are
+// installed at their home locations later, all at once, by a
+// checkpoint.  logcommitd() checkpoints when the disk is idle,
+// and commit() does it when the log has no room for another
+// transaction.  Only the committed blocks are in the cache
+// at a checkpoint, so it can write them from there.
+//
+// The xv6 file system's log is the region its superblock
+// describes, and its superblock also says how many blocks
+// one FS system call may write.  Its on-disk format:
+//   header blocks, containing a count, then block #s for A, B, C, ...
 //   block A
 //   block B
 //   block C
 //   ...
-// Log appends are synchronous.
+// There are as many header blocks as it takes to number
+// every block in the log; the count is in the first one.
+// Each commit appends its blocks and their numbers; a block
+// logged twice is there twice, and the later copy wins.
+//
+// An ext2 file system with a journal (as made by mke2fs -j)
+// logs its metadata to the blocks of the journal inode, in
+// the JBD2 format Linux uses, so that Linux and e2fsck can
+// recover it too.  Data blocks are not logged; commit writes
+// them back first, so that committed metadata never points
+// at data that has not reached the disk (ext3's "ordered"
+// mode).  The journal is circular: transactions are appended
+// at its head and a checkpoint moves its tail up to the head.
+// A metadata block that is freed while an earlier copy is
+// still in the journal is revoked, so that recovery does not
+// write the old copy over whatever the block holds now.
 
-// Contents of the header block, used for both the on-disk header block
-// and to keep track in memory of logged block# before commit.
+// The blocks logged by the open transaction.
 struct logheader {
   int n;
-  int block[LOGSIZE];
+  uint *block;     // l->size of them
 };
 
+#define NCOMMITBUCKET 8
+
+// Group commit statistics, for logdump().
+struct logstat {
+  uint ncommit;    // transactions committed
+  uint nckpt;      // checkpoints
+  uint nblocks;    // blocks logged, after absorption
+  uint nops;       // FS sys calls committed
+  uint maxblocks;  // largest transaction
+  uint hist[NCOMMITBUCKET];  // transactions, by blocks logged as a power of 2
+};
+
+#define NPIN (PGSIZE / sizeof(uint))
+#define NLOGENT (BSIZE / sizeof(uint))  // entries per xv6 log header block
+
 struct log {
   struct spinlock lock;
   int start;
-  int size;
+  int nhead;       // xv6 log header blocks
+  int size;        // most blocks in one transaction
+  int maxop;       // most blocks one FS sys call writes
+  int cap;         // log blocks available to transactions
+  int txmax;       // most log blocks one transaction takes
+  int used;        // log blocks holding uninstalled transactions
+  uint *ckpt;      // committed blocks the next checkpoint installs
+  int nckpt;
+  uint *revoke;    // blocks the open transaction revokes
+  int nrevoke;
   int outstanding; // how many FS sys calls are executing.
   int committing;  // in commit(), please wait.
+  int due;         // commit as soon as no FS sys calls are executing
+  int nops;        // FS sys calls in this transaction
   int dev;
   struct logheader lh;
+  struct logformat *fmt;
+  struct logstat stat;
+
+  // JBD2 journals only.
+  uint *map;       // disk block of each journal block
+  uint first;      // first journal block for transactions
+  uint maxlen;     // journal blocks
+  uint head;       // journal block for the next transaction
+  uint seq;        // sequence number of the next transaction
+  uchar uuid[16];
+  void (*setrecover)(int, int);  // mark the FS as needing recovery, or not
+};
+
+// The on-disk format of a log.
+struct logformat {
+  void (*recover)(struct log*);  // install committed transactions
+  void (*commit)(struct log*);   // append lh's blocks to the log; commit
+  void (*checkpoint)(struct log*);  // forget the installed transactions
 };
-struct log log;
 
-static void recover_from_log(void);
-static void commit();
+static struct log logs[NLOG];
+
+static void commit(struct log*);
+static void checkpoint(struct log*);
+
+// The log of device dev, or 0 if it has none.
+static struct log*
+logof(int dev)
+{
+  struct log *l;
+
+  for(l = logs; l < logs+NLOG; l++)
+    if(l->fmt && l->dev == dev)
+      return l;
+  return 0;
+}
+
+// Set up an unused struct log for dev.
+static struct log*
+logalloc(int dev, struct logformat *fmt)
+{
+  struct log *l;
+
+  for(l = logs; l < logs+NLOG; l++){
+    if(l->fmt == 0){
+      initlock(&l->lock, "log");
+      l->dev = dev;
+      l->fmt = fmt;
+      if((l->ckpt = (uint*)kalloc()) == 0 ||
+         (l->revoke = (uint*)kalloc()) == 0 ||
+         (l->lh.block = (uint*)kalloc()) == 0)
+        panic("logalloc: out of memory");
+      return l;
+    }
+  }
+  panic("logalloc: no logs");
+}
+
+// How many blocks a transaction may log, given room for
+// that many in the log.  A transaction takes a quarter of a
+// large log, so that several commits fit between checkpoints,
+// but has room for a few FS sys calls if the log allows.
+static int
+logtxsize(int room, int maxop)
+{
+  int size = max(room / 4, 3*maxop);
+
+  return min(min(size, room), (int)NPIN);
+}
+
+// Copy block from to block to, on the log's device.  If
+// magic is not 0, it replaces the first word of the copy.
+static void
+copyblock(struct log *l, uint from, uint to, uint magic)
+{
+  struct buf *lbuf = bread(l->dev, from); // read log block
+  struct buf *dbuf = bgetblk(l->dev, to); // dst
+  memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
+  if(magic)
+    *(uint*)dbuf->data = magic;
+  bwrite(dbuf);  // write dst to disk
+  brelse(lbuf);
+  brelse(dbuf);
+}
+
+#define NLOGBATCH 32   // blocks written before waiting for them
+
+// Copy committed blocks to their home location, and free
+// the log.  The cached copies are pinned, so they are the
+// newest committed ones.  Must not run while a transaction
+// is open with blocks in it.
+static void
+checkpoint(struct log *l)
+{
+  int i, j, n;
+  struct buf *dbuf[NLOGBATCH];
+
+  // Start a batch of writes, then wait for them.
+  for (i = 0; i < l->nckpt; i += n) {
+    n = min(l->nckpt - i, NLOGBATCH);
+    for (j = 0; j < n; j++) {
+      dbuf[j] = bread(l->dev, l->ckpt[i+j]);
+      bwrite_async(dbuf[j]);  // write dst to disk
+    }
+    for (j = 0; j < n; j++) {
+      bwait(dbuf[j]);
+      brelse(dbuf[j]);
+    }
+  }
+  l->fmt->checkpoint(l);
+  l->nckpt = 0;
+  l->used = 0;
+  acquire(&l->lock);
+  l->stat.nckpt++;
+  release(&l->lock);
+}
+
+//PAGEBREAK!
+// The xv6 log.
+
+// Return entry k of the xv6 log header: the count for k = 0,
+// and then the logged block numbers.
+static uint
+xv6log_entry(struct log *l, int k)
+{
+  struct buf *buf = bread(l->dev, l->start + k/NLOGENT);
+  uint e = ((uint*)buf->data)[k%NLOGENT];
+  brelse(buf);
+  return e;
+}
+
+// Set the log header's count to n.  Writing the first header
+// block is the true point at which a transaction commits, so
+// entries 1..k-1 must already be on disk.
+static void
+xv6log_setcount(struct log *l, int n, int k)
+{
+  struct buf *buf = bread(l->dev, l->start);
+  uint *hb = (uint*)buf->data;
+  int i;
+
+  hb[0] = n;
+  for (i = l->used+1; i < k && i < NLOGENT; i++)
+    hb[i] = l->lh.block[i-1-l->used];
+  bwrite(buf);
+  brelse(buf);
+}
+
+static void
+xv6log_recover(struct log *l)
+{
+  int tail, n;
+
+  n = xv6log_entry(l, 0);
+  // if committed, copy from log to disk, oldest first
+  for (tail = 0; tail < n; tail++)
+    copyblock(l, l->start+l->nhead+tail, xv6log_entry(l, tail+1), 0);
+  xv6log_setcount(l, 0, 0); // clear the log
+}
+
+// Append the modified blocks to the log from the cache, and
+// commit.
+static void
+xv6log_commit(struct log *l)
+{
+  int i, j, n, k, end;
+  struct buf *to[NLOGBATCH];
+  struct buf *buf;
+
+  // The log blocks are consecutive, so starting a batch of
+  // writes before waiting lets the disk do them as a few
+  // large ones.
+  for (i = 0; i < l->lh.n; i += n) {
+    n = min(l->lh.n - i, NLOGBATCH);
+    for (j = 0; j < n; j++) {
+      to[j] = bgetblk(l->dev, l->start+l->nhead+l->used+i+j); // log block
+      struct buf *from = bread(l->dev, l->lh.block[i+j]); // cache block
+      memmove(to[j]->data, from->data, BSIZE);
+      bwrite_async(to[j]);  // write the log
+      brelse(from);
+    }
+    for (j = 0; j < n; j++) {
+      bwait(to[j]);
+      brelse(to[j]);
+    }
+  }
+
+  // Number the new blocks in the header blocks after the first.
+  end = l->used + l->lh.n + 1;
+  for (k = max(l->used+1, NLOGENT); k < end; ) {
+    buf = bread(l->dev, l->start + k/NLOGENT);
+    do {
+      ((uint*)buf->data)[k%NLOGENT] = l->lh.block[k-1-l->used];
+      k++;
+    } while (k < end && k%NLOGENT != 0);
+    bwrite(buf);
+    brelse(buf);
+  }
+  xv6log_setcount(l, l->used + l->lh.n, end);  // the real commit
+  l->used += l->lh.n;
+}
+
+static void
+xv6log_checkpoint(struct log *l)
+{
+  xv6log_setcount(l, 0, 0);  // Erase the transactions from the log
+}
+
+static struct logformat xv6log = {
+  xv6log_recover,
+  xv6log_commit,
+  xv6log_checkpoint,
+};
 
 void
 initlog(int dev)
 {
-  if (sizeof(struct logheader) >= BSIZE)
-    panic("initlog: too big logheader");
-
   struct superblock sb;
-  initlock(&log.lock, "log");
+  struct log *l = logalloc(dev, &xv6log);
   xv6fs_readsb(dev, &sb);
-  log.start = sb.logstart;
-  log.size = sb.nlog;
-  log.dev = dev;
-  recover_from_log();
+  l->start = sb.logstart;
+  for (l->nhead = 1; l->nhead*NLOGENT < 1 + sb.nlog - l->nhead; l->nhead++)
+    ;
+  // ckpt holds a page of block numbers; ignore any log space
+  // beyond that.
+  l->cap = min(sb.nlog - l->nhead, (int)NPIN);
+  l->maxop = sb.maxop ? sb.maxop : MAXOPBLOCKS;
+  l->size = l->txmax = logtxsize(l->cap, l->maxop);
+  if (l->size < l->maxop)
+    panic("initlog: log too small");
+  xv6log_recover(l);
+}
+
+//PAGEBREAK!
+// JBD2 journals.  Every field on disk is big-endian.
+
+#define JBD2_MAGIC           0xc03b3998
+#define JBD2_DESCRIPTOR      1
+#define JBD2_COMMIT          2
+#define JBD2_SUPERBLOCK_V1   3
+#define JBD2_SUPERBLOCK_V2   4
+#define JBD2_REVOKE          5
+
+#define JBD2_FLAG_ESCAPE     1  // block began with JBD2_MAGIC
+#define JBD2_FLAG_SAME_UUID  2  // no uuid follows the tag
+#define JBD2_FLAG_LAST_TAG   8
+
+#define JBD2_INCOMPAT_REVOKE 0x1
+
+struct jbd2_header {
+  uint magic;
+  uint blocktype;
+  uint sequence;
+};
+
+struct jbd2_super {
+  struct jbd2_header h;
+  uint blocksize;
+  uint maxlen;          // blocks in the journal
+  uint first;           // first block of log information
+  uint sequence;        // first transaction expected in the log
+  uint start;           // block of that transaction, 0 if clean
+  uint errno;
+  uint feature_compat;  // version 2 only
+  uint feature_incompat;
+  uint feature_ro_compat;
+  uchar uuid[16];
+};
+
+// A descriptor block is a header followed by one tag per
+// logged block, each followed by a uuid unless it has
+// JBD2_FLAG_SAME_UUID.  The logged blocks follow it.
+struct jbd2_tag {
+  uint blocknr;
+  ushort checksum;
+  ushort flags;
+};
+#define JBD2_NTAGS ((BSIZE - sizeof(struct jbd2_header) - 16) / sizeof(struct jbd2_tag))
+
+// A revoke block is a header, the number of bytes used, and
+// the numbers of blocks not to replay from this or earlier
+// transactions.
+struct jbd2_revoke {
+  struct jbd2_header h;
+  uint count;
+};
+#define JBD2_NREVOKE ((BSIZE - sizeof(struct jbd2_revoke)) / sizeof(uint))
+#define JBD2_REVOKEBLOCKS ((NPIN + JBD2_NREVOKE - 1) / JBD2_NREVOKE)
+
+#define NREVOKE  (PGSIZE / (2*sizeof(uint)))
+
+static uint
+be32(uint x)
+{
+  return (x>>24) | ((x>>8)&0xff00) | ((x<<8)&0xff0000) | (x<<24);
+}
+
+static ushort
+be16(ushort x)
+{
+  return (x>>8) | (x<<8);
+}
+
+// Journal block after i, wrapping around to the start.
+static uint
+jnext(struct log *l, uint i)
+{
+  return (i+1 < l->maxlen) ? i+1 : l->first;
 }
 
-// Copy committed blocks from log to their home location
+// Fill in a block header.
 static void
-install_trans(void)
+jheader(struct buf *b, uint type, uint seq)
 {
-  int tail;
+  struct jbd2_header *h = (struct jbd2_header*)b->data;
 
-  for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
-    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
-    memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
-    bwrite(dbuf);  // write dst to disk
-    brelse(lbuf);
-    brelse(dbuf);
-  }
+  memset(b->data, 0, BSIZE);
+  h->magic = be32(JBD2_MAGIC);
+  h->blocktype = be32(type);
+  h->sequence = be32(seq);
 }
 
-// Read the log header from disk into the in-memory log header
+// Point the journal superblock at transaction seq, which
+// starts at start, or mark the journal clean if start is 0.
 static void
-read_head(void)
+jwritesuper(struct log *l, uint seq, uint start)
+{
+  struct buf *b = bread(l->dev, l->map[0]);
+  struct jbd2_super *js = (struct jbd2_super*)b->data;
+
+  js->sequence = be32(seq);
+  js->start = be32(start);
+  js->feature_incompat |= be32(JBD2_INCOMPAT_REVOKE);
+  bwrite(b);
+  brelse(b);
+}
+
+enum { JSCAN, JREVOKE, JREPLAY };
+
+// Has block been revoked by transaction seq or a later one?
+static int
+jrevoked(uint *revoke, int nrevoke, uint block, uint seq)
 {
-  struct buf *buf = bread(log.dev, log.start);
-  struct logheader *lh = (struct logheader *) (buf->data);
   int i;
-  log.lh.n = lh->n;
-  for (i = 0; i < log.lh.n; i++) {
-    log.lh.block[i] = lh->block[i];
+
+  for(i = 0; i < nrevoke; i++)
+    if(revoke[2*i] == block && revoke[2*i+1] >= seq)
+      return 1;
+  return 0;
+}
+
+// One pass over the committed transactions in the journal,
+// starting with transaction seq at journal block start.
+// JSCAN finds the end of the log, returning the sequence
+// number of the first transaction without a commit block.
+// JREVOKE collects revoke records, and JREPLAY copies every
+// logged block that was not revoked to its home location.
+static uint
+jpass(struct log *l, int pass, uint seq, uint start, uint end,
+      uint *revoke, int *nrevoke)
+{
+  struct buf *b;
+  struct jbd2_header *h;
+  struct jbd2_tag *t;
+  struct jbd2_revoke *r;
+  uint i, block, flags;
+  uchar *p;
+  int k;
+
+  i = start;
+  for(;;){
+    if(pass != JSCAN && seq == end)
+      break;
+    b = bread(l->dev, l->map[i]);
+    h = (struct jbd2_header*)b->data;
+    if(be32(h->magic) != JBD2_MAGIC || be32(h->sequence) != seq){
+      brelse(b);
+      break;
+    }
+    i = jnext(l, i);
+
+    switch(be32(h->blocktype)){
+    case JBD2_DESCRIPTOR:
+      p = b->data + sizeof(*h);
+      while(p + sizeof(*t) <= b->data + BSIZE){
+        t = (struct jbd2_tag*)p;
+        block = be32(t->blocknr);
+        flags = be16(t->flags);
+        if(pass == JREPLAY && !jrevoked(revoke, *nrevoke, block, seq))
+          copyblock(l, l->map[i], block,
+                    (flags & JBD2_FLAG_ESCAPE) ? be32(JBD2_MAGIC) : 0);
+        i = jnext(l, i);
+        p += sizeof(*t);
+        if((flags & JBD2_FLAG_SAME_UUID) == 0)
+          p += 16;
+        if(flags & JBD2_FLAG_LAST_TAG)
+          break;
+      }
+      break;
+    case JBD2_COMMIT:
+      seq++;
+      break;
+    case JBD2_REVOKE:
+      r = (struct jbd2_revoke*)b->data;
+      if(pass != JREVOKE)
+        break;
+      for(p = b->data + sizeof(*r); p < b->data + be32(r->count); p += 4){
+        block = be32(*(uint*)p);
+        for(k = 0; k < *nrevoke; k++)
+          if(revoke[2*k] == block)
+            break;
+        if(k == *nrevoke){
+          if(*nrevoke >= NREVOKE)
+            panic("jbd2: too many revoked blocks");
+          revoke[2*k] = block;
+          (*nrevoke)++;
+        }
+        revoke[2*k + 1] = seq;
+      }
+      break;
+    default:
+      brelse(b);
+      return seq;
+    }
+    brelse(b);
   }
-  brelse(buf);
+  return seq;
 }
 
-// Write in-memory log header to disk.
-// This is the true point at which the
-// current transaction commits.
 static void
-write_head(void)
+jbd2_recover(struct log *l)
 {
-  struct buf *buf = bread(log.dev, log.start);
-  struct logheader *hb = (struct logheader *) (buf->data);
-  int i;
-  hb->n = log.lh.n;
-  for (i = 0; i < log.lh.n; i++) {
-    hb->block[i] = log.lh.block[i];
+  struct buf *b;
+  struct jbd2_super *js;
+  uint seq, start, end, *revoke;
+  int nrevoke;
+
+  b = bread(l->dev, l->map[0]);
+  js = (struct jbd2_super*)b->data;
+  seq = be32(js->sequence);
+  start = be32(js->start);
+  brelse(b);
+
+  if(start != 0){
+    end = jpass(l, JSCAN, seq, start, 0, 0, 0);
+    if(end != seq){
+      cprintf("jbd2: replaying transactions %d-%d\n", seq, end-1);
+      if((revoke = (uint*)kalloc()) == 0)
+        panic("jbd2_recover");
+      nrevoke = 0;
+      jpass(l, JREVOKE, seq, start, end, revoke, &nrevoke);
+      jpass(l, JREPLAY, seq, start, end, revoke, &nrevoke);
+      kfree((char*)revoke);
+    }
+    seq = end;
   }
-  bwrite(buf);
-  brelse(buf);
+
+  // Start the log afresh.  A start of 0 says the journal
+  // holds nothing to replay.
+  l->seq = seq;
+  l->head = l->first;
+  jwritesuper(l, l->seq, 0);
+  l->setrecover(l->dev, 0);
+}
+
+// Write a descriptor block and the blocks it describes, from
+// the cache, starting at journal block i, and for as many of
+// lh's blocks from *n on as fit.  Returns the next free block.
+static uint
+jbd2_writedesc(struct log *l, uint i, int *n)
+{
+  struct buf *desc, *to[JBD2_NTAGS];
+  struct jbd2_tag *t;
+  uchar *p;
+  int k, nto;
+
+  desc = bgetblk(l->dev, l->map[i]);
+  jheader(desc, JBD2_DESCRIPTOR, l->seq);
+  i = jnext(l, i);
+
+  t = 0;
+  nto = 0;
+  p = desc->data + sizeof(struct jbd2_header);
+  while(*n < l->lh.n && p + sizeof(*t) + 16 <= desc->data + BSIZE){
+    struct buf *from = bread(l->dev, l->lh.block[*n]); // cache block
+    to[nto] = bgetblk(l->dev, l->map[i]); // log block
+    memmove(to[nto]->data, from->data, BSIZE);
+    brelse(from);
+
+    t = (struct jbd2_tag*)p;
+    t->blocknr = be32(l->lh.block[*n]);
+    t->flags = 0;
+    if(*(uint*)to[nto]->data == be32(JBD2_MAGIC)){
+      *(uint*)to[nto]->data = 0;
+      t->flags |= JBD2_FLAG_ESCAPE;
+    }
+    p += sizeof(*t);
+    if(nto == 0){
+      memmove(p, l->uuid, 16);
+      p += 16;
+    } else
+      t->flags |= JBD2_FLAG_SAME_UUID;
+    t->flags = be16(t->flags);
+
+    bwrite_async(to[nto++]);  // write the log
+    i = jnext(l, i);
+    (*n)++;
+  }
+  t->flags |= be16(JBD2_FLAG_LAST_TAG);
+  bwrite_async(desc);
+
+  for(k = 0; k < nto; k++){
+    bwait(to[k]);
+    brelse(to[k]);
+  }
+  bwait(desc);
+  brelse(desc);
+  return i;
+}
+
+static void
+jbd2_commit(struct log *l)
+{
+  struct buf *b;
+  struct jbd2_revoke *r;
+  uint i, *p, start;
+  int n, k;
+
+  start = l->head;
+  i = l->head;
+  for(n = 0; n < l->lh.n; )
+    i = jbd2_writedesc(l, i, &n);
+
+  for(n = 0; n < l->nrevoke; n += k){
+    k = min(l->nrevoke - n, JBD2_NREVOKE);
+    b = bgetblk(l->dev, l->map[i]);
+    jheader(b, JBD2_REVOKE, l->seq);
+    r = (struct jbd2_revoke*)b->data;
+    r->count = be32(sizeof(*r) + k*sizeof(uint));
+    p = (uint*)(b->data + sizeof(*r));
+    memmove(p, l->revoke + n, k*sizeof(uint));
+    for(; p < (uint*)(b->data + sizeof(*r)) + k; p++)
+      *p = be32(*p);
+    bwrite(b);
+    brelse(b);
+    i = jnext(l, i);
+  }
+
+  // The commit block is the real commit.
+  b = bgetblk(l->dev, l->map[i]);
+  jheader(b, JBD2_COMMIT, l->seq);
+  bwrite(b);
+  brelse(b);
+  i = jnext(l, i);
+
+  // The first transaction since a checkpoint: point the
+  // superblock at it, and have the FS say that the journal
+  // needs recovery.  Neither is written before the commit
+  // block, so a crash in between just loses the transaction.
+  if(l->used == 0){
+    jwritesuper(l, l->seq, start);
+    l->setrecover(l->dev, 1);
+  }
+
+  l->used += (i + l->cap - start) % l->cap;
+  l->head = i;
+  l->seq++;
 }
 
 static void
-recover_from_log(void)
+jbd2_checkpoint(struct log *l)
 {
-  read_head();
-  install_trans(); // if committed, copy from log to disk
-  log.lh.n = 0;
-  write_head(); // clear the log
+  // Every transaction before l->seq is installed, so the
+  // journal is empty until the next commit.
+  jwritesuper(l, l->seq, 0);
+  l->setrecover(l->dev, 0);
+}
+
+static struct logformat jbd2log = {
+  jbd2_recover,
+  jbd2_commit,
+  jbd2_checkpoint,
+};
+
+// Use the JBD2 journal in blocks map[0..n-1] of device dev,
+// for operations of up to maxop blocks, after replaying it.
+// setrecover(dev, on) marks the file system as having a
+// journal to replay, while it holds uncheckpointed
+// transactions.  Returns 0, and does not log dev, if
+// the journal is not one we can use.  Only version 2
+// superblocks can say that the journal holds revoke blocks.
+int
+initjournal(int dev, uint *map, int n, int maxop,
+            void (*setrecover)(int, int))
+{
+  struct buf *b;
+  struct jbd2_super *js;
+  struct log *l;
+  uint type, maxlen, first, incompat;
+  int cap, size;
+
+  b = bread(dev, map[0]);
+  js = (struct jbd2_super*)b->data;
+  type = be32(js->h.blocktype);
+  maxlen = be32(js->maxlen);
+  first = be32(js->first);
+  incompat = be32(js->feature_incompat);
+
+  // A transaction takes its blocks, a descriptor block for
+  // every JBD2_NTAGS of them, revoke blocks and a commit
+  // block.  Keep a block spare, so that a full log does not
+  // look empty.
+  cap = maxlen - first;
+  size = (cap - 3 - (int)JBD2_REVOKEBLOCKS) * JBD2_NTAGS / (JBD2_NTAGS + 1);
+  if(be32(js->h.magic) != JBD2_MAGIC || type != JBD2_SUPERBLOCK_V2 ||
+     be32(js->blocksize) != BSIZE || maxlen > n || first == 0 ||
+     first >= maxlen || size < maxop ||
+     (incompat & ~JBD2_INCOMPAT_REVOKE)){
+    brelse(b);
+    cprintf("jbd2: unsupported journal on dev %d\n", dev);
+    return 0;
+  }
+
+  l = logalloc(dev, &jbd2log);
+  l->map = map;
+  l->setrecover = setrecover;
+  l->first = first;
+  l->maxlen = maxlen;
+  memmove(l->uuid, js->uuid, 16);
+  brelse(b);
+
+  l->cap = cap;
+  l->maxop = maxop;
+  l->size = logtxsize(size, l->maxop);
+  l->txmax = l->size + (l->size + JBD2_NTAGS - 1) / JBD2_NTAGS +
+             JBD2_REVOKEBLOCKS + 1;
+  jbd2_recover(l);
+  return 1;
 }
 
+//PAGEBREAK!
 // called at the start of each FS system call.
 void
 begin_op(void)
 {
-  acquire(&log.lock);
-  while(1){
-    if(log.committing){
-      sleep(&log, &log.lock);
-    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
-      // this op might exhaust log space; wait for commit.
-      sleep(&log, &log.lock);
-    } else {
-      log.outstanding += 1;
-      release(&log.lock);
-      break;
+  struct log *l, *m;
+
+  for(;;){
+    // Reserve space in every log at once, so that we never
+    // sleep holding a reservation another log's commit is
+    // waiting for.
+    for(l = logs; l < logs+NLOG; l++)
+      if(l->fmt)
+        acquire(&l->lock);
+    for(l = logs; l < logs+NLOG; l++){
+      if(l->fmt == 0)
+        continue;
+      if(l->committing)
+        break;
+      if(l->lh.n + (l->outstanding+1)*l->maxop > l->size)
+        break;  // this op might exhaust log space; wait for commit.
+    }
+    if(l == logs+NLOG){
+      for(m = logs; m < logs+NLOG; m++){
+        if(m->fmt){
+          m->outstanding += 1;
+          m->nops += 1;
+          release(&m->lock);
+        }
+      }
+      return;
     }
+    for(m = logs; m < logs+NLOG; m++)
+      if(m->fmt && m != l)
+        release(&m->lock);
+    sleep(l, &l->lock);
+    release(&l->lock);
   }
 }
 
+// Run fn (commit or checkpoint) on l, with no FS sys calls
+// allowed to start.  Caller holds l->lock, and none are
+// executing; returns with l->lock held.
+static void
+logexclusive(struct log *l, void (*fn)(struct log*))
+{
+  l->committing = 1;
+  // call fn w/o holding locks, since not allowed
+  // to sleep with locks.
+  release(&l->lock);
+  fn(l);
+  acquire(&l->lock);
+  l->committing = 0;
+  wakeup(l);
+}
+
 // called at the end of each FS system call.
-// commits if this was the last outstanding operation.
+// commits each log if this was its last outstanding operation
+// and the transaction is due or too full for another one.
 void
 end_op(void)
 {
-  int do_commit = 0;
+  struct log *l;
 
-  acquire(&log.lock);
-  log.outstanding -= 1;
-  if(log.committing)
-    panic("log.committing");
-  if(log.outstanding == 0){
-    do_commit = 1;
-    log.committing = 1;
-  } else {
-    // begin_op() may be waiting for log space,
-    // and decrementing log.outstanding has decreased
-    // the amount of reserved space.
-    wakeup(&log);
+  for(l = logs; l < logs+NLOG; l++){
+    if(l->fmt == 0)
+      continue;
+    acquire(&l->lock);
+    l->outstanding -= 1;
+    if(l->committing)
+      panic("log.committing");
+    if(l->outstanding == 0 &&
+       (l->due || LOGCOMMITTICKS == 0 || l->lh.n + l->maxop > l->size)){
+      logexclusive(l, commit);
+    } else {
+      if(l->outstanding == 0 && l->lh.n == 0)
+        l->nops = 0;  // nothing was written; nothing to count
+      // begin_op() may be waiting for log space,
+      // and decrementing log.outstanding has decreased
+      // the amount of reserved space.
+      wakeup(l);
+    }
+    release(&l->lock);
   }
-  release(&log.lock);
+}
 
-  if(do_commit){
-    // call commit w/o holding locks, since not allowed
-    // to sleep with locks.
-    commit();
-    acquire(&log.lock);
-    log.committing = 0;
-    wakeup(&log);
-    release(&log.lock);
+// Commit the open transaction of device dev, or of every
+// device if dev is -1, and wait until it is on disk.
+void
+logflush(int dev)
+{
+  struct log *l;
+  uint n;
+
+  for(l = logs; l < logs+NLOG; l++){
+    if(l->fmt == 0 || (dev != -1 && l->dev != dev))
+      continue;
+    acquire(&l->lock);
+    while(l->committing)
+      sleep(l, &l->lock);
+    if(l->lh.n > 0){
+      if(l->outstanding == 0)
+        logexclusive(l, commit);
+      else {
+        // the last end_op() will commit it.
+        l->due = 1;
+        n = l->stat.ncommit;
+        while(l->stat.ncommit == n)
+          sleep(l, &l->lock);
+      }
+    }
+    release(&l->lock);
   }
 }
 
-// Copy modified blocks from cache to log.
-static void
-write_log(void)
+// The group commit and checkpoint process.  Every
+// LOGCOMMITTICKS ticks, commits and then checkpoints each
+// idle log, or marks its transaction due if FS sys calls
+// are still executing in it.
+void
+logcommitd(void)
 {
-  int tail;
+  struct log *l;
+  uint ticks0;
 
-  for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *to = bread(log.dev, log.start+tail+1); // log block
-    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
-    memmove(to->data, from->data, BSIZE);
-    bwrite(to);  // write the log
-    brelse(from);
-    brelse(to);
+  for(;;){
+    acquire(&tickslock);
+    ticks0 = ticks;
+    while(ticks - ticks0 < LOGCOMMITTICKS)
+      sleep(&ticks, &tickslock);
+    release(&tickslock);
+
+    for(l = logs; l < logs+NLOG; l++){
+      if(l->fmt == 0)
+        continue;
+      acquire(&l->lock);
+      if(!l->committing){
+        if(l->outstanding > 0){
+          if(l->lh.n > 0)
+            l->due = 1;
+        } else {
+          if(l->lh.n > 0)
+            logexclusive(l, commit);
+          if(l->used > 0)
+            logexclusive(l, checkpoint);
+        }
+      }
+      release(&l->lock);
+    }
+  }
+}
+
+// Print the group commit statistics of each log.
+void
+logdump(void)
+{
+  struct log *l;
+  struct logstat st;
+  int i, n;
+
+  for(l = logs; l < logs+NLOG; l++){
+    if(l->fmt == 0)
+      continue;
+    acquire(&l->lock);
+    st = l->stat;
+    release(&l->lock);
+    n = st.ncommit ? st.ncommit : 1;
+    cprintf("log dev %d: %d commits %d blocks %d ops, max %d blocks, %d checkpoints\n",
+            l->dev, st.ncommit, st.nblocks, st.nops, st.maxblocks, st.nckpt);
+    cprintf("  avg %d blocks %d ops per commit\n", st.nblocks / n, st.nops / n);
+    cprintf("  blocks per commit:");
+    for(i = 0; i < NCOMMITBUCKET; i++)
+      if(st.hist[i])
+        cprintf(" <%d:%d", 1 << (i+1), st.hist[i]);
+    cprintf("\n");
   }
 }
 
+// Count a transaction of n blocks.
 static void
-commit()
+logcount(struct log *l, int n)
 {
-  if (log.lh.n > 0) {
-    write_log();     // Write modified blocks from cache to log
-    write_head();    // Write header to disk -- the real commit
-    install_trans(); // Now install writes to home locations
-    log.lh.n = 0;
-    write_head();    // Erase the transaction from the log
+  int i;
+
+  acquire(&l->lock);
+  l->stat.ncommit++;
+  l->stat.nblocks += n;
+  l->stat.nops += l->nops;
+  if(n > l->stat.maxblocks)
+    l->stat.maxblocks = n;
+  for(i = 0; i < NCOMMITBUCKET-1 && n >= (2 << i); i++)
+    ;
+  l->stat.hist[i]++;
+  release(&l->lock);
+}
+
+static void
+commit(struct log *l)
+{
+  int i, j, n = l->lh.n;
+
+  if (n > 0) {
+    bflush(l->dev);     // Write data blocks first
+    l->fmt->commit(l);  // Append modified blocks to the log and commit
+    // The blocks stay pinned until the checkpoint installs them.
+    for (i = 0; i < n; i++) {
+      for (j = 0; j < l->nckpt; j++)
+        if (l->ckpt[j] == l->lh.block[i])
+          break;
+      if (j == l->nckpt)
+        l->ckpt[l->nckpt++] = l->lh.block[i];
+    }
+    logcount(l, n);
+    l->lh.n = 0;
+    l->nrevoke = 0;
+    if (l->used + l->txmax > l->cap)
+      checkpoint(l);    // No room for another transaction
   }
+  l->due = 0;
+  l->nops = 0;
+}
+
+// How many blocks one FS sys call may write to dev.
+int
+log_opblocks(int dev)
+{
+  struct log *l = logof(dev);
+
+  return l ? l->maxop : MAXOPBLOCKS;
 }
 
 // Caller has modified b->data and is done with the buffer.
 // Record the block number and pin in the cache with B_DIRTY.
-// commit()/write_log() will do the disk write.
+// b->data is now the block's contents, so mark it B_VALID:
+// otherwise commit's bread would write it home early.
+// commit() and checkpoint() will do the disk writes.
+// On a device without a log, b is written back later instead.
 //
 // log_write() replaces bwrite(); a typical use is:
 //   bp = bread(...)
@@ -213,22 +999,68 @@ commit()
 void
 log_write(struct buf *b)
 {
+  struct log *l;
   int i;
 
-  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+  if ((l = logof(b->dev)) == 0) {
+    bdwrite(b);
+    return;
+  }
+  if (l->lh.n >= l->size)
     panic("too big a transaction");
-  if (log.outstanding < 1)
+  if (l->outstanding < 1)
     panic("log_write outside of trans");
 
-  acquire(&log.lock);
-  for (i = 0; i < log.lh.n; i++) {
-    if (log.lh.block[i] == b->blockno)   // log absorbtion
+  acquire(&l->lock);
+  for (i = 0; i < l->lh.n; i++) {
+    if (l->lh.block[i] == b->blockno)   // log absorbtion
       break;
   }
-  log.lh.block[i] = b->blockno;
-  if (i == log.lh.n)
-    log.lh.n++;
-  b->flags |= B_DIRTY; // prevent eviction
-  release(&log.lock);
+  l->lh.block[i] = b->blockno;
+  if (i == l->lh.n)
+    l->lh.n++;
+  for (i = 0; i < l->nrevoke; i++) {
+    if (l->revoke[i] == b->blockno) {   // in use again
+      l->revoke[i] = l->revoke[--l->nrevoke];
+      break;
+    }
+  }
+  bdelwri(b, 0);  // the log writes it, not the flusher
+  b->flags |= B_VALID|B_DIRTY; // prevent eviction
+  release(&l->lock);
 }
 
+// Block blockno of dev has been freed.  If the log holds a
+// copy of it, make sure recovery does not write that copy
+// back after the block has been reused.
+void
+log_revoke(int dev, uint blockno)
+{
+  struct log *l;
+  int i;
+
+  if ((l = logof(dev)) == 0)
+    return;
+  if (l->outstanding < 1)
+    panic("log_revoke outside of trans");
+
+  acquire(&l->lock);
+  for (i = 0; i < l->nrevoke; i++)
+    if (l->revoke[i] == blockno)
+      goto out;
+  for (i = 0; i < l->lh.n; i++)
+    if (l->lh.block[i] == blockno)
+      break;
+  if (i == l->lh.n) {
+    for (i = 0; i < l->nckpt; i++)
+      if (l->ckpt[i] == blockno)
+        break;
+    if (i == l->nckpt)
+      goto out;     // never logged, or installed already
+  }
+  if (l->nrevoke >= NPIN)
+    panic("log_revoke: too many");
+  l->revoke[l->nrevoke++] = blockno;
+out:
+  release(&l->lock);
+}
@@ -58,3 +58,40 @@ iderw(struct buf *b)
     memmove(b->data, p, BSIZE);
   b->flags |= B_VALID;
 }
+
+// The memory disk completes every transfer at once.
+void
+iderw_async(struct buf *b)
+{
+  int async;
+
+  async = b->flags & B_ASYNC;
+  b->flags &= ~B_ASYNC;
+  iderw(b);
+  if(async)
+    biodone(b);
+}
+
+void
+iderw_wait(struct buf *b)
+{
+}
+
+void
+idetimer(void)
+{
+}
+
+// Nothing to watch: the memory disk never times out.
+void
+idewatchd(void)
+{
+  acquire(&tickslock);
+  for(;;)
+    sleep(&idewatchd, &tickslock);
+}
+
+void
+idedump(void)
+{
+}
@@ -16,6 +16,8 @@
 #endif
 
 #define NINODES 200
+#define NLOGENT (BSIZE / sizeof(uint))  // entries per log header block
+#define NLOGMAX (4096 / sizeof(uint))   // log blocks the kernel can use: a page of numbers
 
 // Disk layout:
 // [ boot block | sb block | log | inode blocks | free bit map | data blocks ]
@@ -23,6 +25,7 @@
 int nbitmap = FSSIZE/(BSIZE*8) + 1;
 int ninodeblocks = NINODES / IPB + 1;
 int nlog = LOGSIZE;
+int maxop = MAXOPBLOCKS;
 int nmeta;    // Number of meta blocks (boot, sb, nlog, inode, bitmap)
 int nblocks;  // Number of data blocks
 
@@ -67,7 +70,7 @@ xint(uint x)
 int
 main(int argc, char *argv[])
 {
-  int i, cc, fd;
+  int i, cc, fd, nhead;
   uint rootino, inum, off;
   struct dirent de;
   char buf[BSIZE];
@@ -76,8 +79,36 @@ main(int argc, char *argv[])
 
   static_assert(sizeof(int) == 4, "Integers must be 4 bytes!");
 
+  // -l sets the number of log blocks, and -m the blocks one
+  // FS operation may write; a bigger log lets the kernel
+  // commit bigger transactions.
+  while((i = getopt(argc, argv, "l:m:")) != -1){
+    switch(i){
+    case 'l':
+      nlog = atoi(optarg);
+      break;
+    case 'm':
+      maxop = atoi(optarg);
+      break;
+    default:
+      argc = 0;
+      break;
+    }
+  }
+  argc -= optind - 1;
+  argv += optind - 1;
+
   if(argc < 2){
-    fprintf(stderr, "Usage: mkfs fs.img files...\n");
+    fprintf(stderr, "Usage: mkfs [-l nlog] [-m maxop] fs.img files...\n");
+    exit(1);
+  }
+  // The kernel's log header takes as many blocks as it needs
+  // to hold a number for each of the rest; see initlog.
+  for(nhead = 1; nhead*NLOGENT < 1 + nlog - nhead; nhead++)
+    ;
+  if(maxop < 4 || nlog - nhead < maxop || nlog - nhead > NLOGMAX ||
+     2 + nlog + ninodeblocks + nbitmap >= FSSIZE){
+    fprintf(stderr, "mkfs: bad log size %d or op size %d\n", nlog, maxop);
     exit(1);
   }
 
@@ -101,9 +132,10 @@ main(int argc, char *argv[])
   sb.logstart = xint(2);
   sb.inodestart = xint(2+nlog);
   sb.bmapstart = xint(2+nlog+ninodeblocks);
+  sb.maxop = xint(maxop);
 
-  printf("nmeta %d (boot, super, log blocks %u inode blocks %u, bitmap blocks %u) blocks %d total %d\n",
-         nmeta, nlog, ninodeblocks, nbitmap, nblocks, FSSIZE);
+  printf("nmeta %d (boot, super, log blocks %u inode blocks %u, bitmap blocks %u) blocks %d total %d maxop %d\n",
+         nmeta, nlog, ninodeblocks, nbitmap, nblocks, FSSIZE, maxop);
 
   freeblock = nmeta;     // the first free block that we can allocate
 
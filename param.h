@@ -3,14 +3,29 @@
 #define NCPU          8  // maximum number of CPUs
 #define NOFILE       16  // open files per process
 #define NFILE       100  // open files per system
-#define NINODE       50  // maximum number of active i-nodes
+#define NINODE       50  // inode cache entries before it grows
+#define NDENTRY     128  // size of directory entry cache
 #define NDEV         10  // maximum major device number
 #define ROOTDEV       1  // device number of file system root disk
 #define EXT2DEV       2  // device number of file system ext2 disk
 #define MAXARG       32  // max exec arguments
-#define MAXOPBLOCKS  10  // max # of blocks any FS op writes
-#define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
+#define MAXOPBLOCKS  10  // max # of blocks any FS op writes, unless the superblock says
+#define LOGSIZE      (MAXOPBLOCKS*3)  // blocks in on-disk log, unless mkfs is told
+#define NLOG          2  // maximum number of devices with a log
+#define LOGCOMMITTICKS 10 // ticks a transaction stays open for more sys calls
 #define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
-#define FSSIZE       1000  // size of xv6 file system in blocks
+#define BFLUSHTICKS  100  // ticks between write-backs of delayed writes
+#define BFLUSHBATCH  64   // buffers written per sorted batch by bflush
+#define BCACHEFRAC   4    // disk block cache grows to 1/BCACHEFRAC of memory
+#define RAMIN        2    // initial read-ahead window, in blocks
+#define RAMAX        32   // maximum read-ahead window, in blocks
+#define IDEMAXBLOCKS 8    // most adjacent blocks merged into one disk request
+#define IDEDEADLINE  50   // ticks before a waiting disk request jumps the queue
+#define IDETIMEOUT   300  // ticks before an unfinished disk request is retried
+#define IDEMAXRETRY  3    // retries before a disk request is given up on
+#ifndef IDESCHED
+#define IDESCHED     "cscan"  // disk scheduler: "fifo" or "cscan"
+#endif
+#define FSSIZE       2000  // size of xv6 file system in blocks
 #define EXT2FSSIZE   20000 // size of ext2 file system in blocks
 
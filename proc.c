@@ -157,6 +157,28 @@ userinit(void)
   release(&ptable.lock);
 }
 
+// Start a kernel process that runs fn, which must never
+// return.  It begins in forkret like any new process, but
+// forkret returns into fn instead of into user space.
+void
+kthread(char *name, void (*fn)(void))
+{
+  struct proc *p;
+
+  if((p = allocproc()) == 0)
+    panic("kthread: no procs");
+  if((p->pgdir = setupkvm()) == 0)
+    panic("kthread: out of memory?");
+  *(uint*)((char*)p->context + sizeof(*p->context)) = (uint)fn;
+  p->sz = 0;
+  p->parent = initproc;
+  safestrcpy(p->name, name, sizeof(p->name));
+
+  acquire(&ptable.lock);
+  p->state = RUNNABLE;
+  release(&ptable.lock);
+}
+
 // Grow current process's memory by n bytes.
 // Return 0 on success, -1 on failure.
 int
@@ -412,6 +434,10 @@ forkret(void)
     xv6fs_iinit(ROOTDEV);
     initlog(ROOTDEV);
     ext2fs_iinit(EXT2DEV);
+    kthread("bflush", bflushd);
+    kthread("idewatch", idewatchd);
+    if(LOGCOMMITTICKS > 0)
+      kthread("logcommit", logcommitd);
   }
 
   // Return to "caller", actually trapret (see allocproc).
@@ -11,6 +11,7 @@
 #include "mmu.h"
 #include "proc.h"
 #include "fs.h"
+#include "ext2fs.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "file.h"
@@ -118,7 +119,7 @@ sys_fstat(void)
 int
 sys_link(void)
 {
-  char name[DIRSIZ], *new, *old;
+  char name[EXT2_NAME_LEN], *new, *old;
   struct inode *dp, *ip;
 
   if(argstr(0, &old) < 0 || argstr(1, &new) < 0)
@@ -148,6 +149,7 @@ sys_link(void)
     dp->iops->iunlockput(dp);
     goto bad;
   }
+  dcache_remove(dp, name);
   dp->iops->iunlockput(dp);
   ip->iops->iput(ip);
 
@@ -164,29 +166,12 @@ bad:
   return -1;
 }
 
-// Is the directory dp empty except for "." and ".." ?
-static int
-isdirempty(struct inode *dp)
-{
-  int off;
-  struct dirent de;
-
-  for(off=2*sizeof(de); off<dp->size; off+=sizeof(de)){
-    if(dp->iops->readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
-      panic("isdirempty: readi");
-    if(de.inum != 0)
-      return 0;
-  }
-  return 1;
-}
-
 //PAGEBREAK!
 int
 sys_unlink(void)
 {
   struct inode *ip, *dp;
-  struct dirent de;
-  char name[DIRSIZ], *path;
+  char name[EXT2_NAME_LEN], *path;
   uint off;
 
   if(argstr(0, &path) < 0)
@@ -210,14 +195,13 @@ sys_unlink(void)
 
   if(ip->nlink < 1)
     panic("unlink: nlink < 1");
-  if(ip->type == T_DIR && !isdirempty(ip)){
+  if(ip->type == T_DIR && !ip->iops->dirempty(ip)){
     ip->iops->iunlockput(ip);
     goto bad;
   }
 
-  memset(&de, 0, sizeof(de));
-  if(dp->iops->writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
-    panic("unlink: writei");
+  dp->iops->dirunlink(dp, off);
+  dcache_remove(dp, name);
   if(ip->type == T_DIR){
     dp->nlink--;
     dp->iops->iupdate(dp);
@@ -242,7 +226,7 @@ static struct inode*
 create(char *path, short type, short major, short minor)
 {
   struct inode *ip, *dp;
-  char name[DIRSIZ];
+  char name[EXT2_NAME_LEN];
 
   if((dp = nameiparent(path, name)) == 0)
     return 0;
@@ -259,6 +243,7 @@ create(char *path, short type, short major, short minor)
 
   if((ip = dp->iops->ialloc(dp->dev, type)) == 0)
     panic("create: ialloc");
+  dcache_purge(ip);
 
   ip->iops->ilock(ip);
   ip->major = major;
@@ -276,6 +261,7 @@ create(char *path, short type, short major, short minor)
 
   if(dp->iops->dirlink(dp, name, ip->inum) < 0)
     panic("create: dirlink");
+  dcache_remove(dp, name);
 
   dp->iops->iunlockput(dp);
 
@@ -442,3 +428,36 @@ sys_pipe(void)
   fd[1] = fd1;
   return 0;
 }
+
+// Write all delayed writes back to disk.
+int
+sys_sync(void)
+{
+  begin_op();
+  ext2fs_sync(EXT2DEV);
+  end_op();
+  logflush(-1);
+  bflush(-1);
+  return 0;
+}
+
+// Write back the delayed writes of the device holding
+// the file open as fd.
+int
+sys_fsync(void)
+{
+  struct file *f;
+
+  if(argfd(0, 0, &f) < 0)
+    return -1;
+  if(f->type != FD_INODE)
+    return -1;
+  if(f->ip->dev == EXT2DEV){
+    begin_op();
+    ext2fs_sync(EXT2DEV);
+    end_op();
+  }
+  logflush(f->ip->dev);
+  bflush(f->ip->dev);
+  return 0;
+}
@@ -23,6 +23,8 @@ int getpid(void);
 char* sbrk(int);
 int sleep(int);
 int uptime(void);
+int sync(void);
+int fsync(int);
 
 // ulib.c
 int stat(const char*, struct stat*);
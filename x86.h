@@ -30,6 +30,21 @@ outw(ushort port, ushort data)
   asm volatile("out %0,%1" : : "a" (data), "d" (port));
 }
 
+static inline uint
+inl(ushort port)
+{
+  uint data;
+
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+  return data;
+}
+
+static inline void
+outl(ushort port, uint data)
+{
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+}
+
 static inline void
 outsl(int port, const void *addr, int cnt)
 {
@@ -57,6 +72,26 @@ stosl(void *addr, int data, int cnt)
                "memory", "cc");
 }
 
+// CPU cycle counter.
+static inline uint64
+rdtsc(void)
+{
+  uint64 v;
+
+  asm volatile("rdtsc" : "=A" (v));
+  return v;
+}
+
+// Index of the least significant set bit of v; v must be non-zero.
+static inline uint
+bsf(uint v)
+{
+  uint r;
+
+  asm("bsf %1,%0" : "=r" (r) : "rm" (v) : "cc");
+  return r;
+}
+
 struct segdesc;
 
 static inline void